@@ -0,0 +1,12 @@
+
+AC_DEFUN([SST_ENABLE_COMPACT_ACTIVITY_KEY], [
+  enable_compact_activity_key_happy="no"
+
+  AC_ARG_ENABLE([compact-activity-key], [AS_HELP_STRING([--enable-compact-activity-key],
+      [Packs the delivery time, priority, order tag and queue order of each event and activity into a single 128-bit ordering key.  This saves 8 bytes per activity and turns every event queue comparison into one wide compare, but limits priorities to 0-255 and order tags to 24 bits.  Element libraries must be built against a core configured the same way.])])
+
+  AS_IF([test "x$enable_compact_activity_key" = "xyes" ], [enable_compact_activity_key_happy="yes"])
+
+  AS_IF([test "$enable_compact_activity_key_happy" = "yes"], [AC_DEFINE([__SST_COMPACT_ACTIVITY_KEY__], [1],
+              [Packs the ordering information of activities into a single 128-bit key.])])
+])
@@ -37,6 +37,10 @@
 #define FINALEVENTPRIORITY     98
 #define EXITPRIORITY           99
 
+#if defined(__SST_COMPACT_ACTIVITY_KEY__) && !defined(__SIZEOF_INT128__)
+#error "The compact activity key requires a compiler with 128-bit integer support"
+#endif
+
 extern int main(int argc, char** argv);
 
 namespace SST {
@@ -45,11 +49,20 @@ namespace SST {
 class Activity : public SST::Core::MemPoolItem
 {
 public:
+#ifdef __SST_COMPACT_ACTIVITY_KEY__
+    using uint128_t = unsigned __int128;
+
+    Activity() :
+        delivery_time(0),
+        order_key(0)
+    {}
+#else
     Activity() :
         delivery_time(0),
         priority_order(0),
         queue_order(0)
     {}
+#endif
     virtual ~Activity() {}
 
     /**
@@ -63,12 +76,19 @@ public:
     class less
     {
     public:
+#ifdef __SST_COMPACT_ACTIVITY_KEY__
+        inline bool operator()(const Activity* lhs, const Activity* rhs) const
+        {
+            return lhs->getOrderingKey<T, P, Q>() < rhs->getOrderingKey<T, P, Q>();
+        }
+#else
         inline bool operator()(const Activity* lhs, const Activity* rhs) const
         {
             if ( T && lhs->delivery_time != rhs->delivery_time ) return lhs->delivery_time < rhs->delivery_time;
             if ( P && lhs->priority_order != rhs->priority_order ) return lhs->priority_order < rhs->priority_order;
             return Q && lhs->queue_order < rhs->queue_order;
         }
+#endif
 
         // // Version without branching.  Still need to test to see if
         // // this is faster than the above implementation for "real"
@@ -106,12 +126,19 @@ public:
     class greater
     {
     public:
+#ifdef __SST_COMPACT_ACTIVITY_KEY__
+        inline bool operator()(const Activity* lhs, const Activity* rhs) const
+        {
+            return lhs->getOrderingKey<T, P, Q>() > rhs->getOrderingKey<T, P, Q>();
+        }
+#else
         inline bool operator()(const Activity* lhs, const Activity* rhs) const
         {
             if ( T && lhs->delivery_time != rhs->delivery_time ) return lhs->delivery_time > rhs->delivery_time;
             if ( P && lhs->priority_order != rhs->priority_order ) return lhs->priority_order > rhs->priority_order;
             return Q && lhs->queue_order > rhs->queue_order;
         }
+#endif
 
         // // Version without branching.  Still need to test to see if
         // // this is faster than the above implementation for "real"
@@ -147,6 +174,62 @@ public:
     /** Return the time at which this Activity will be delivered */
     inline SimTime_t getDeliveryTime() const { return delivery_time; }
 
+#ifdef __SST_COMPACT_ACTIVITY_KEY__
+    /**
+       Layout of the low half of the compact ordering key.  The high
+       half is the delivery time.
+
+       Priorities above max_priority and order tags above
+       max_order_tag saturate to the maximum value.  Activities that
+       saturate still sort after all activities with smaller values,
+       but are only ordered among themselves by queue order.  Order
+       tags are the link delivery order, so ConfigGraph warns at
+       startup when there are more links than max_order_tag.
+
+       Only the low queue_order_bits of the queue order are stored.
+       TimeVortex implementations hand out queue orders through
+       TimeVortex::assignQueueOrder(), which renumbers the pending
+       activities before the stored value would wrap (see
+       TimeVortex::renumberQueueOrder()), so the insertion order of
+       ties is kept.  The thread safe binned map TimeVortex is the
+       only exception and lets the queue order wrap.
+     */
+    static constexpr int      queue_order_bits = 32;
+    static constexpr int      order_tag_bits   = 24;
+    static constexpr int      order_tag_shift  = queue_order_bits;
+    static constexpr int      priority_shift   = queue_order_bits + order_tag_bits;
+    static constexpr uint64_t queue_order_mask = (1ul << queue_order_bits) - 1;
+    static constexpr uint64_t max_order_tag    = (1ul << order_tag_bits) - 1;
+    static constexpr uint64_t max_priority     = (1ul << (64 - priority_shift)) - 1;
+
+    /** Return the Priority of this Activity */
+    inline int getPriority() const { return (int)(order_key >> priority_shift); }
+
+    /** Sets the order tag */
+    inline void setOrderTag(uint32_t tag)
+    {
+        uint64_t value = tag > max_order_tag ? max_order_tag : tag;
+        order_key      = (order_key & ~(max_order_tag << order_tag_shift)) | (value << order_tag_shift);
+    }
+
+    /** Return the order tag associated with this activity */
+    inline uint32_t getOrderTag() const { return (uint32_t)((order_key >> order_tag_shift) & max_order_tag); }
+
+    /** Returns the queue order associated with this activity */
+    inline uint64_t getQueueOrder() const { return order_key & queue_order_mask; }
+
+    /**
+       Returns the ordering key containing only the fields selected by
+       the template parameters (see less and greater), so that
+       activities can be compared with a single 128-bit compare.
+     */
+    template <bool T, bool P, bool Q>
+    inline uint128_t getOrderingKey() const
+    {
+        constexpr uint64_t mask = (P ? ~queue_order_mask : 0) | (Q ? queue_order_mask : 0);
+        return (static_cast<uint128_t>(T ? delivery_time : 0) << 64) | (order_key & mask);
+    }
+#else
     /** Return the Priority of this Activity */
     inline int getPriority() const { return (int)(priority_order >> 32); }
 
@@ -158,6 +241,7 @@ public:
 
     /** Returns the queue order associated with this activity */
     inline uint64_t getQueueOrder() const { return queue_order; }
+#endif
 
     virtual bool isEvent() const  = 0;
     virtual bool isAction() const = 0;
@@ -183,6 +267,24 @@ public:
     virtual void printTrackingInfo(const std::string& UNUSED(header), Output& UNUSED(out)) const {}
 #endif
 
+#ifdef __SST_COMPACT_ACTIVITY_KEY__
+    /** Set a new Queue order */
+    void setQueueOrder(uint64_t order) { order_key = (order_key & ~queue_order_mask) | (order & queue_order_mask); }
+
+    virtual void copyAllDeliveryInfo(const Activity* act)
+    {
+        delivery_time = act->delivery_time;
+        order_key     = act->order_key;
+    }
+
+protected:
+    /** Set the priority of the Activity */
+    void setPriority(uint64_t priority)
+    {
+        if ( priority > max_priority ) priority = max_priority;
+        order_key = (order_key & ~(max_priority << priority_shift)) | (priority << priority_shift);
+    }
+#else
     /** Set a new Queue order */
     void setQueueOrder(uint64_t order) { queue_order = order; }
 
@@ -196,6 +298,7 @@ public:
 protected:
     /** Set the priority of the Activity */
     void setPriority(uint64_t priority) { priority_order = (priority_order & 0x00000000FFFFFFFFul) | (priority << 32); }
+#endif
 
     /**
        Gets the delivery time info as a string.  To be used in
@@ -214,12 +317,32 @@ protected:
     // Function used by derived classes to serialize data members.
     // This class is not serializable, because not all class that
     // inherit from it need to be serializable.
+#ifdef __SST_COMPACT_ACTIVITY_KEY__
+    // Checkpoints store the fields in the same form as the default
+    // layout
     void serialize_order(SST::Core::Serialization::serializer& ser) override
     {
         SST_SER(delivery_time);
+        uint64_t priority_order =
+            (static_cast<uint64_t>(getPriority()) << 32) | static_cast<uint64_t>(getOrderTag());
+        uint64_t queue_order = getQueueOrder();
         SST_SER(priority_order);
         SST_SER(queue_order);
+        if ( ser.mode() == SST::Core::Serialization::serializer::UNPACK ) {
+            order_key = 0;
+            setPriority(priority_order >> 32);
+            setOrderTag(static_cast<uint32_t>(priority_order));
+            setQueueOrder(queue_order);
+        }
     }
+#else
+    void serialize_order(SST::Core::Serialization::serializer& ser) override
+    {
+        SST_SER(delivery_time);
+        SST_SER(priority_order);
+        SST_SER(queue_order);
+    }
+#endif
 
     ImplementVirtualSerializable(SST::Activity);
 
@@ -227,6 +350,12 @@ private:
     // Data members
     SimTime_t delivery_time;
 
+#ifdef __SST_COMPACT_ACTIVITY_KEY__
+    // Holds the priority (high bits), order tag and queue order (low
+    // bits).  Together with delivery_time this forms the 128-bit
+    // ordering key.
+    uint64_t order_key;
+#else
     // This will hold both the priority (high bits) and the link order
     // (low_bits)
     uint64_t priority_order;
@@ -234,6 +363,7 @@ private:
     // Used for TimeVortex implementations that don't naturally keep
     // the insertion order
     uint64_t queue_order;
+#endif
 };
 
 } // namespace SST
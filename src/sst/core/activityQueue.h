@@ -35,6 +35,22 @@ public:
     /** Returns the next activity */
     virtual Activity* front()                    = 0;
 
+    /**
+       Insert a set of activities into the queue.  The result is the
+       same as calling insert() on each activity in order.  Derived
+       classes can override to insert the whole set at once (taking
+       any lock only once).
+
+       @param begin Pointer to the first activity to insert
+       @param n Number of activities to insert
+     */
+    virtual void insertBatch(Activity** begin, size_t n)
+    {
+        for ( size_t i = 0; i < n; ++i ) {
+            insert(begin[i]);
+        }
+    }
+
 private:
 };
 
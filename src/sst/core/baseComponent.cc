@@ -104,6 +104,12 @@ BaseComponent::~BaseComponent()
         delete handler;
     }
 
+    // Leave any ClockedArrays so they don't tick a deleted instance
+    for ( auto* member : clocked_arrays_ ) {
+        if ( member->factor ) sim_->leaveClockedArray(member);
+        delete member;
+    }
+
     // Delete any portModules
     for ( auto port : portModules ) {
         delete port;
@@ -195,6 +201,52 @@ BaseComponent::registerClock(TimeConverter* tc, Clock::HandlerBase* handler, boo
     return tcRet;
 }
 
+TimeConverter*
+BaseComponent::registerClockedArray_impl(TimeConverter* tc, const std::type_info& type,
+    const std::function<ClockedArrayMemberBase*()>& create, bool regAll)
+{
+    // Add this clock to our registered_clocks_ set
+    registered_clocks_.insert(tc->getFactor());
+
+    // See if we've already joined an array of this type
+    ClockedArrayMemberBase* member = nullptr;
+    for ( auto* x : clocked_arrays_ ) {
+        if ( typeid(*x) == type ) {
+            member = x;
+            break;
+        }
+    }
+    if ( nullptr == member ) {
+        member = create();
+        clocked_arrays_.push_back(member);
+    }
+
+    if ( member->factor != tc->getFactor() ) {
+        if ( member->factor ) sim_->leaveClockedArray(member);
+        member->factor = tc->getFactor();
+        sim_->joinClockedArray(member);
+    }
+
+    // if regAll is true set tc as the default for the component and
+    // for all the links
+    if ( regAll ) {
+        setDefaultTimeBaseForLinks(tc);
+        my_info_->defaultTimeBase = tc;
+    }
+    return tc;
+}
+
+void
+BaseComponent::unregisterClockedArray_impl(const std::type_info& type)
+{
+    for ( auto* member : clocked_arrays_ ) {
+        if ( typeid(*member) == type && member->factor ) {
+            sim_->leaveClockedArray(member);
+            member->factor = 0;
+        }
+    }
+}
+
 Cycle_t
 BaseComponent::reregisterClock(TimeConverter freq, Clock::HandlerBase* handler)
 {
@@ -219,6 +271,32 @@ BaseComponent::getNextClockCycle(TimeConverter freq)
     return sim_->getNextClockCycle(freq, CLOCKPRIORITY);
 }
 
+void
+BaseComponent::sleepClock(TimeConverter freq, Clock::HandlerBase* handler, Cycle_t wake_cycle)
+{
+    sim_->sleepClock(freq, handler, CLOCKPRIORITY, wake_cycle);
+}
+
+void
+BaseComponent::sleepClockUntilEvent(TimeConverter freq, Clock::HandlerBase* handler, Link* link, Cycle_t wake_cycle)
+{
+    // The handler for events received on link is stored in the
+    // delivery_info of the other side of the link
+    Event::HandlerBase* ev_handler = reinterpret_cast<Event::HandlerBase*>(link->pair_link->delivery_info);
+    if ( nullptr == ev_handler ) {
+        fatal(CALL_INFO_LONG, 1,
+            "ERROR: sleepClockUntilEvent() called with a link that has no event handler (polling links are not "
+            "supported)\n");
+    }
+    sim_->sleepClock(freq, handler, CLOCKPRIORITY, wake_cycle, ev_handler);
+}
+
+void
+BaseComponent::wakeClock(TimeConverter freq, Clock::HandlerBase* handler)
+{
+    sim_->wakeClock(freq, handler, CLOCKPRIORITY);
+}
+
 void
 BaseComponent::unregisterClock(TimeConverter* tc, Clock::HandlerBase* handler)
 {
@@ -502,6 +580,13 @@ BaseComponent::configureSelfLink(const std::string& name, Event::HandlerBase* ha
     return configureLink(name, handler);
 }
 
+void
+BaseComponent::enableLocalEventScheduler()
+{
+    if ( nullptr != my_info_->local_event_scheduler_ ) return;
+    my_info_->local_event_scheduler_ = sim_->createLocalEventScheduler();
+}
+
 UnitAlgebra
 BaseComponent::getCoreTimeBase() const
 {
@@ -893,6 +978,9 @@ BaseComponent::serialize_order(SST::Core::Serialization::serializer& ser)
             p.second = sim_->getClockForHandler(handler);
             SST_SER(p);
         }
+
+        // Members keep track of their own clock factor
+        SST_SER(clocked_arrays_);
         break;
     }
     case SST::Core::Serialization::serializer::UNPACK:
@@ -923,6 +1011,12 @@ BaseComponent::serialize_order(SST::Core::Serialization::serializer& ser)
                 sim_->registerClock(p.second, p.first, CLOCKPRIORITY);
             }
         }
+
+        // Rejoin any ClockedArrays
+        SST_SER(clocked_arrays_);
+        for ( auto* member : clocked_arrays_ ) {
+            if ( member->factor ) sim_->joinClockedArray(member);
+        }
         break;
     }
     case SST::Core::Serialization::serializer::MAP:
@@ -13,6 +13,7 @@
 #define SST_CORE_BASECOMPONENT_H
 
 #include "sst/core/clock.h"
+#include "sst/core/clockedArray.h"
 #include "sst/core/componentInfo.h"
 #include "sst/core/eli/elementinfo.h"
 #include "sst/core/event.h"
@@ -31,6 +32,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <typeinfo>
 #include <vector>
 
 using namespace SST::Statistics;
@@ -332,6 +334,22 @@ protected:
      */
     Link* configureSelfLink(const std::string& name, Event::HandlerBase* handler = nullptr);
 
+    /** Sends the events on this component's self links through a
+     * local event scheduler instead of directly to the TimeVortex.
+     * Only the earliest pending self link event is kept in the
+     * TimeVortex, which helps components that keep many events
+     * pending on their self links.  Events are delivered in the same
+     * order except that ties with the self link events of other
+     * components (same time, priority and order tag) are broken by
+     * when the scheduler put the event in the TimeVortex.
+     *
+     * Must be called before the end of the init phase, since the
+     * scheduler is attached to the links when they are finalized.
+     * Applies to all self links with handlers in this component's
+     * link map.
+     */
+    void enableLocalEventScheduler();
+
     /** Registers a clock for this component.
         @param freq Frequency for the clock in SI units
         @param handler Pointer to Clock::HandlerBase which is to be invoked
@@ -386,6 +404,67 @@ protected:
     Cycle_t reregisterClock(TimeConverter* freq, Clock::HandlerBase* handler);
     Cycle_t reregisterClock(TimeConverter freq, Clock::HandlerBase* handler);
 
+    /** Puts a clock handler to sleep until the specified cycle.  The
+        handler will not be called again until wake_cycle, at which
+        point it is automatically reregistered.  If every handler on
+        the clock is asleep, the clock stops firing until the first
+        one wakes up.  Typically called from inside the handler, which
+        should then return false.
+        @param freq Frequency the handler is registered with
+        @param handler Handler to put to sleep
+        @param wake_cycle Next cycle the handler should be called on
+     */
+    void sleepClock(TimeConverter freq, Clock::HandlerBase* handler, Cycle_t wake_cycle);
+
+    /** Puts a clock handler to sleep until the next event arrives on
+        the specified link or until wake_cycle, whichever comes first.
+        The handler is called on the first cycle after the event is
+        delivered.  The link must have been configured with an event
+        handler.
+        @param freq Frequency the handler is registered with
+        @param handler Handler to put to sleep
+        @param link Link to watch for events
+        @param wake_cycle Optional cycle to wake up on if no event arrives
+     */
+    void sleepClockUntilEvent(
+        TimeConverter freq, Clock::HandlerBase* handler, Link* link, Cycle_t wake_cycle = MAX_CYCLE);
+
+    /** Wakes a sleeping clock handler so that it is called on the
+        next cycle.  Has no effect if the handler is not asleep.
+     */
+    void wakeClock(TimeConverter freq, Clock::HandlerBase* handler);
+
+    /** Adds this instance to the ClockedArray for classT and funcT
+        at the specified frequency.  Instead of calling a handler per
+        instance, the core calls funcT once per cycle with every
+        instance on this thread that has joined the array:
+
+          static void funcT(Cycle_t cycle, classT* const* instances, size_t count)
+
+        The array is registered with the clock alongside any other
+        handlers, and membership is restored on restart from a
+        checkpoint.  Instances must not join or leave from inside
+        funcT.  Calling this again for the same classT and funcT moves
+        the instance to the new frequency.
+        @param freq Frequency for the clock in SI units
+        @param regAll Should this clock period be used as the default
+        time base for all of the links connected to this component
+        @return the TimeConverter object representing the clock frequency
+    */
+    template <typename classT, auto funcT>
+    TimeConverter* registerClockedArray(const std::string& freq, bool regAll = true)
+    {
+        return registerClockedArray_impl(getTimeConverter(freq), typeid(ClockedArrayMember<classT, funcT>),
+            [this] { return new ClockedArrayMember<classT, funcT>(static_cast<classT*>(this)); }, regAll);
+    }
+
+    /** Removes this instance from the ClockedArray for classT and funcT */
+    template <typename classT, auto funcT>
+    void unregisterClockedArray()
+    {
+        unregisterClockedArray_impl(typeid(ClockedArrayMember<classT, funcT>));
+    }
+
     /** Returns the next Cycle that the TimeConverter would fire
         If called prior to the simulation run loop, next Cycle is 0.
         If called after the simulation run loop completes (e.g., during
@@ -440,6 +519,14 @@ private:
      */
     void registerClock_impl(TimeConverter* tc, Clock::HandlerBase* handler, bool regAll);
 
+    /**
+       Joins the ClockedArray identified by type, creating the member
+       record with create() the first time.
+     */
+    TimeConverter* registerClockedArray_impl(TimeConverter* tc, const std::type_info& type,
+        const std::function<ClockedArrayMemberBase*()>& create, bool regAll);
+    void           unregisterClockedArray_impl(const std::type_info& type);
+
     /**
         Handles default timebase setup
     */
@@ -1135,6 +1222,9 @@ private:
     std::vector<Clock::HandlerBase*> clock_handlers_;
     std::set<SimTime_t>              registered_clocks_;
 
+    // ClockedArrays this instance has joined
+    std::vector<ClockedArrayMemberBase*> clocked_arrays_;
+
     void  addSelfLink(const std::string& name);
     Link* getLinkFromParentSharedPort(const std::string& port, std::vector<ConfigPortModule>& port_modules);
 
@@ -21,6 +21,35 @@
 
 namespace SST {
 
+/**
+   Tool attached to an event handler that wakes a sleeping clock
+   handler on the next event delivered to the event handler.
+ */
+class Clock::EventWake : public Event::HandlerBase::AttachPoint
+{
+public:
+    EventWake(Clock* clock, Clock::HandlerBase* handler, Event::HandlerBase* ev_handler) :
+        clock(clock),
+        handler(handler),
+        ev_handler(ev_handler),
+        armed(false)
+    {}
+
+    uintptr_t registerHandler(const AttachPointMetaData& UNUSED(mdata)) override { return 0; }
+
+    void beforeHandler(uintptr_t UNUSED(key), const Event* UNUSED(ev)) override
+    {
+        if ( armed ) clock->wakeHandler(handler);
+    }
+
+    void afterHandler(uintptr_t UNUSED(key)) override {}
+
+    Clock*              clock;
+    Clock::HandlerBase* handler;
+    Event::HandlerBase* ev_handler;
+    bool                armed;
+};
+
 Clock::Clock(TimeConverter* period, int priority) :
     Action(),
     currentCycle(0),
@@ -33,6 +62,9 @@ Clock::Clock(TimeConverter* period, int priority) :
 Clock::~Clock()
 {
     // Handlers are owned by BaseComponent and are deleted there
+    for ( auto* wake : eventWakes ) {
+        delete wake;
+    }
 }
 
 bool
@@ -57,8 +89,9 @@ Clock::unregisterHandler(Clock::HandlerBase* handler, bool& empty)
             break;
         }
     }
+    removeSleeping(handler);
 
-    empty = staticHandlerMap.empty();
+    empty = staticHandlerMap.empty() && sleepingHandlerMap.empty();
 
     return 0;
 }
@@ -70,11 +103,140 @@ Clock::isHandlerRegistered(Clock::HandlerBase* handler)
     for ( auto* h : staticHandlerMap ) {
         if ( h == handler ) return true;
     }
+    for ( auto& x : sleepingHandlerMap ) {
+        if ( x.second == handler ) return true;
+    }
 
     return false;
 }
 
 
+void
+Clock::sleepHandler(Clock::HandlerBase* handler, Cycle_t wake_cycle, Event::HandlerBase* wake_handler)
+{
+    // Take the handler off the active list.  If we are in the middle
+    // of calling handlers, just clear the slot and let execute()
+    // remove it so we don't invalidate its iterator.
+    bool found = false;
+    for ( auto iter = staticHandlerMap.begin(); iter != staticHandlerMap.end(); ++iter ) {
+        if ( *iter == handler ) {
+            if ( executing )
+                *iter = nullptr;
+            else
+                staticHandlerMap.erase(iter);
+            found = true;
+            break;
+        }
+    }
+    // If it's already asleep, this just updates the wake conditions
+    if ( !found && !removeSleeping(handler) ) return;
+
+    // The earliest a handler can be called again is next cycle
+    if ( !scheduled ) updateCurrentCycle();
+    if ( wake_cycle <= currentCycle ) wake_cycle = currentCycle + 1;
+    sleepingHandlerMap.emplace(wake_cycle, handler);
+
+    if ( wake_handler ) {
+        EventWake* wake = nullptr;
+        for ( auto* x : eventWakes ) {
+            if ( x->handler == handler && x->ev_handler == wake_handler ) {
+                wake = x;
+                break;
+            }
+        }
+        if ( !wake ) {
+            wake = new EventWake(this, handler, wake_handler);
+            eventWakes.push_back(wake);
+            wake_handler->attachTool(wake, AttachPointMetaData());
+        }
+        wake->armed = true;
+    }
+
+    // If the clock is already parked, the wake cycle may now be
+    // earlier than the one it is parked at
+    if ( !scheduled ) park();
+}
+
+
+void
+Clock::wakeHandler(Clock::HandlerBase* handler)
+{
+    if ( !removeSleeping(handler) ) return;
+
+    // Can't add to the active list while handlers are being called,
+    // so just have it wake up next cycle
+    if ( executing ) {
+        sleepingHandlerMap.emplace(currentCycle + 1, handler);
+        return;
+    }
+
+    staticHandlerMap.push_back(handler);
+    if ( !scheduled ) {
+        schedule();
+    }
+}
+
+
+bool
+Clock::removeSleeping(Clock::HandlerBase* handler)
+{
+    bool found = false;
+    for ( auto iter = sleepingHandlerMap.begin(); iter != sleepingHandlerMap.end(); ++iter ) {
+        if ( iter->second == handler ) {
+            sleepingHandlerMap.erase(iter);
+            found = true;
+            break;
+        }
+    }
+    if ( !found ) return false;
+
+    for ( auto* wake : eventWakes ) {
+        if ( wake->handler == handler ) wake->armed = false;
+    }
+    return true;
+}
+
+
+void
+Clock::wakeHandlers()
+{
+    auto end = sleepingHandlerMap.upper_bound(currentCycle);
+    for ( auto iter = sleepingHandlerMap.begin(); iter != end; ++iter ) {
+        staticHandlerMap.push_back(iter->second);
+        for ( auto* wake : eventWakes ) {
+            if ( wake->handler == iter->second ) wake->armed = false;
+        }
+    }
+    sleepingHandlerMap.erase(sleepingHandlerMap.begin(), end);
+}
+
+
+void
+Clock::park()
+{
+    scheduled = false;
+    unpark();
+
+    // Handlers waiting only on events will call schedule() through
+    // wakeHandler()
+    Cycle_t wake_cycle = sleepingHandlerMap.begin()->first;
+    if ( wake_cycle == MAX_CYCLE ) return;
+
+    next = wake_cycle * period->getFactor();
+    Simulation_impl::getSimulation()->clock_scheduler_.insert(next, this);
+    parked = true;
+}
+
+
+void
+Clock::unpark()
+{
+    if ( !parked ) return;
+    Simulation_impl::getSimulation()->clock_scheduler_.remove(next, this);
+    parked = false;
+}
+
+
 Cycle_t
 Clock::getNextCycle()
 {
@@ -88,7 +250,15 @@ Clock::execute()
 {
     Simulation_impl* sim = Simulation_impl::getSimulation();
 
-    if ( staticHandlerMap.empty() ) {
+    // Woken up from park().  execute() increments currentCycle
+    // before calling handlers.
+    if ( parked ) {
+        parked       = false;
+        scheduled    = true;
+        currentCycle = sim->getCurrentSimCycle() / period->getFactor() - 1;
+    }
+
+    if ( staticHandlerMap.empty() && sleepingHandlerMap.empty() ) {
         scheduled = false;
         return;
     }
@@ -97,12 +267,29 @@ Clock::execute()
     // currentCycle = period->convertFromCoreTime(sim->getCurrentSimCycle());
     currentCycle++;
 
+    if ( !sleepingHandlerMap.empty() && sleepingHandlerMap.begin()->first <= currentCycle ) {
+        wakeHandlers();
+    }
+
+    executing = true;
     StaticHandlerMap_t::iterator sop_iter;
     for ( sop_iter = staticHandlerMap.begin(); sop_iter != staticHandlerMap.end(); ) {
         Clock::HandlerBase* handler = *sop_iter;
 
+        // Slot is cleared when a handler is put to sleep while
+        // handlers are being called
+        if ( handler == nullptr ) {
+            sop_iter = staticHandlerMap.erase(sop_iter);
+            continue;
+        }
 
-        if ( (*handler)(currentCycle) )
+        if ( (*handler)(currentCycle) ) {
+            sop_iter = staticHandlerMap.erase(sop_iter);
+            // Returning true removes the handler even if it put
+            // itself to sleep
+            removeSleeping(handler);
+        }
+        else if ( *sop_iter == nullptr )
             sop_iter = staticHandlerMap.erase(sop_iter);
         else
             ++sop_iter;
@@ -110,9 +297,17 @@ Clock::execute()
         // (*handler)(currentCycle);
         // ++sop_iter;
     }
+    executing = false;
+
+    // If every handler is asleep, stop ticking until the first one
+    // wakes up
+    if ( staticHandlerMap.empty() && !sleepingHandlerMap.empty() ) {
+        park();
+        return;
+    }
 
     next = sim->getCurrentSimCycle() + period->getFactor();
-    sim->insertActivity(next, this);
+    sim->clock_scheduler_.insert(next, this);
 
     return;
 }
@@ -120,9 +315,12 @@ Clock::execute()
 void
 Clock::schedule()
 {
+    // Stop waiting on the sleeping handlers
+    unpark();
+
     Simulation_impl* sim = Simulation_impl::getSimulation();
     currentCycle         = sim->getCurrentSimCycle() / period->getFactor();
-    SimTime_t next       = (currentCycle * period->getFactor()) + period->getFactor();
+    next                 = (currentCycle * period->getFactor()) + period->getFactor();
 
     // Check to see if we need to insert clock into queue at current
     // simtime.  This happens if the clock would have fired at this
@@ -139,7 +337,7 @@ Clock::schedule()
 
     // std::cout << "Scheduling clock " << period->getFactor() << " at cycle " << next << " current cycle is " <<
     // sim->getCurrentSimCycle() << std::endl;
-    sim->insertActivity(next, this);
+    sim->clock_scheduler_.insert(next, this);
     scheduled = true;
 }
 
@@ -157,6 +355,7 @@ Clock::toString() const
     std::stringstream buf;
     buf << "Clock Activity with period " << period->getFactor() << " to be delivered at " << getDeliveryTime()
         << " with priority " << getPriority() << " with " << staticHandlerMap.size() << " items on clock list";
+    if ( !sleepingHandlerMap.empty() ) buf << " and " << sleepingHandlerMap.size() << " sleeping";
     return buf.str();
 }
 
@@ -171,6 +370,7 @@ Clock::serialize_order(SST::Core::Serialization::serializer& ser)
     SST_SER(period);
     SST_SER(next);
     SST_SER(scheduled);
+    SST_SER(parked);
 }
 
 
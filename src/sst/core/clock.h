@@ -13,9 +13,11 @@
 #define SST_CORE_CLOCK_H
 
 #include "sst/core/action.h"
+#include "sst/core/event.h"
 #include "sst/core/ssthandler.h"
 
 #include <cinttypes>
+#include <map>
 #include <string>
 #include <vector>
 
@@ -24,6 +26,9 @@
 namespace SST {
 
 class TimeConverter;
+namespace Core {
+class ClockScheduler;
+}
 
 /**
  * A Clock class.
@@ -77,7 +82,7 @@ public:
 
     /**
      * Activates this clock object, by inserting into the simulation's
-     * timeVortex for future execution.
+     * ClockScheduler for future execution.
      */
     void schedule();
 
@@ -97,15 +102,46 @@ public:
     bool unregisterHandler(Clock::HandlerBase* handler, bool& empty);
 
     /**
-       Checks to see if a handler is registered with this clock
+       Puts a handler to sleep until the specified cycle.  The handler
+       is taken off the list of handlers called each tick and is put
+       back on the list at wake_cycle, so the next time it is called
+       will be on cycle wake_cycle.  If every handler on the clock is
+       asleep, the clock stops scheduling itself and jumps directly to
+       the earliest wake cycle.
+
+       If wake_handler is not nullptr, the handler will also be woken
+       by the next event delivered to wake_handler.  Use a wake_cycle
+       of MAX_CYCLE to only wake on an event or a call to
+       wakeHandler().
+
+       This can be called from within the handler itself, in which
+       case the handler should return false.  Handlers may be woken
+       earlier than requested (e.g. on restart from a checkpoint).
+     */
+    void sleepHandler(Clock::HandlerBase* handler, Cycle_t wake_cycle, Event::HandlerBase* wake_handler = nullptr);
+
+    /**
+       Wakes a sleeping handler so that it will be called on the next
+       cycle.  Has no effect if the handler is not asleep.
+     */
+    void wakeHandler(Clock::HandlerBase* handler);
+
+    /**
+       Checks to see if a handler is registered with this clock.
+       Sleeping handlers are considered registered.
     */
     bool isHandlerRegistered(Clock::HandlerBase* handler);
 
     std::string toString() const override;
 
 private:
+    friend class Core::ClockScheduler;
+
     /* using HandlerMap_t = std::list<Clock::HandlerBase*>; */
-    using StaticHandlerMap_t = std::vector<Clock::HandlerBase*>;
+    using StaticHandlerMap_t   = std::vector<Clock::HandlerBase*>;
+    using SleepingHandlerMap_t = std::multimap<Cycle_t, Clock::HandlerBase*>;
+
+    class EventWake;
 
     Clock() {}
 
@@ -114,11 +150,29 @@ private:
 
     void execute() override;
 
-    Cycle_t            currentCycle;
-    TimeConverter*     period;
-    StaticHandlerMap_t staticHandlerMap;
-    SimTime_t          next;
-    bool               scheduled;
+    /** Moves handlers whose wake cycle has arrived back onto the active list */
+    void wakeHandlers();
+    /** Removes handler from the sleeping list.  Returns false if it wasn't asleep */
+    bool removeSleeping(Clock::HandlerBase* handler);
+    /** Called when all handlers are asleep to stop the clock until the first wake cycle */
+    void park();
+    /** Takes the clock back out of the ClockScheduler if it is parked */
+    void unpark();
+
+    Cycle_t              currentCycle;
+    TimeConverter*       period;
+    StaticHandlerMap_t   staticHandlerMap;
+    SleepingHandlerMap_t sleepingHandlerMap;
+    SimTime_t            next;
+    bool                 scheduled;
+    bool                 executing = false;
+    // True if the clock is in the ClockScheduler at the wake time of
+    // its first sleeping handler
+    bool                 parked    = false;
+
+    // Tools attached to event handlers to wake sleeping clock
+    // handlers.  They stay attached once created and are reused.
+    std::vector<EventWake*> eventWakes;
 
     void serialize_order(SST::Core::Serialization::serializer& ser) override;
     ImplementSerializable(SST::Clock)
@@ -0,0 +1,163 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_CLOCKEDARRAY_H
+#define SST_CORE_CLOCKEDARRAY_H
+
+#include "sst/core/clock.h"
+#include "sst/core/serialization/serializable.h"
+#include "sst/core/sst_types.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace SST {
+
+class ClockedArrayMemberBase;
+
+/**
+   Clock handler that ticks every instance of a class with a single
+   call.
+
+   Instead of registering a handler per instance, each instance joins
+   the ClockedArray for its class and tick function (see
+   BaseComponent::registerClockedArray()).  There is one ClockedArray
+   per class, tick function and clock frequency on each thread.  It is
+   registered with the clock like any other handler, so it coexists
+   with per-instance handlers on the same clock.  Each cycle the tick
+   function is called once with all the instances that have joined:
+
+     static void func(Cycle_t cycle, classT* const* instances, size_t count)
+
+   The ClockedArray removes itself from the clock once every instance
+   has left.  Leaving moves the last instance into the slot that was
+   freed, so the order of the instances is not preserved.
+ */
+class ClockedArrayBase : public Clock::HandlerBase
+{
+public:
+    ClockedArrayBase() :
+        Clock::HandlerBase()
+    {}
+    virtual ~ClockedArrayBase() {}
+
+    /** Adds the instance held by member to the array */
+    virtual void   add(ClockedArrayMemberBase* member)    = 0;
+    /** Removes the instance held by member from the array */
+    virtual void   remove(ClockedArrayMemberBase* member) = 0;
+    /** Returns the number of instances in the array */
+    virtual size_t size() const                           = 0;
+};
+
+/**
+   Records that an instance has joined a ClockedArray.  This is what
+   gets checkpointed; the ClockedArray itself is rebuilt as instances
+   rejoin on restart.
+ */
+class ClockedArrayMemberBase : public SST::Core::Serialization::serializable
+{
+public:
+    ClockedArrayMemberBase() {}
+    virtual ~ClockedArrayMemberBase() {}
+
+    /** Creates an empty ClockedArray of the type this member joins */
+    virtual ClockedArrayBase* createArray() const = 0;
+
+    /** Factor of the clock the instance is ticked on, or 0 if the
+        instance is not currently in an array */
+    SimTime_t factor = 0;
+
+    /** Slot of the instance in its ClockedArray.  Not checkpointed,
+        since it is reassigned when the instance rejoins */
+    size_t index = 0;
+
+    void serialize_order(SST::Core::Serialization::serializer& ser) override { SST_SER(factor); }
+
+    ImplementVirtualSerializable(SST::ClockedArrayMemberBase)
+};
+
+template <typename classT, auto funcT>
+class ClockedArrayMember;
+
+template <typename classT, auto funcT>
+class ClockedArray : public ClockedArrayBase
+{
+public:
+    ClockedArray() :
+        ClockedArrayBase()
+    {}
+
+    void add(ClockedArrayMemberBase* member) override
+    {
+        auto* m   = static_cast<ClockedArrayMember<classT, funcT>*>(member);
+        m->index  = instances.size();
+        instances.push_back(m->object);
+        members.push_back(m);
+    }
+
+    void remove(ClockedArrayMemberBase* member) override
+    {
+        // Move the last instance into the freed slot
+        size_t index = member->index;
+        auto*  last  = members.back();
+        instances[index] = last->object;
+        members[index]   = last;
+        last->index      = index;
+        instances.pop_back();
+        members.pop_back();
+    }
+
+    size_t size() const override { return instances.size(); }
+
+    bool operator_impl(Cycle_t cycle) override
+    {
+        // Take ourselves off the clock once everyone has left
+        if ( instances.empty() ) return true;
+        funcT(cycle, instances.data(), instances.size());
+        return false;
+    }
+
+    NotSerializable(ClockedArray)
+
+private:
+    std::vector<classT*> instances;
+    /** Member for each entry in instances, used to fix up the index of
+        the instance that is moved by remove() */
+    std::vector<ClockedArrayMember<classT, funcT>*> members;
+};
+
+template <typename classT, auto funcT>
+class ClockedArrayMember : public ClockedArrayMemberBase
+{
+public:
+    explicit ClockedArrayMember(classT* object) :
+        ClockedArrayMemberBase(),
+        object(object)
+    {}
+
+    ClockedArrayMember() {}
+
+    ClockedArrayBase* createArray() const override { return new ClockedArray<classT, funcT>(); }
+
+    classT* object = nullptr;
+
+    void serialize_order(SST::Core::Serialization::serializer& ser) override
+    {
+        ClockedArrayMemberBase::serialize_order(ser);
+        SST_SER(object);
+    }
+
+    ImplementSerializable(ClockedArrayMember)
+};
+
+} // namespace SST
+
+#endif // SST_CORE_CLOCKEDARRAY_H
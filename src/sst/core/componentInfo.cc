@@ -14,6 +14,7 @@
 #include "sst/core/componentInfo.h"
 
 #include "sst/core/configGraph.h"
+#include "sst/core/impl/localEventScheduler.h"
 #include "sst/core/linkMap.h"
 #include "sst/core/serialization/serialize.h"
 #include "sst/core/serialization/serializer.h"
@@ -168,6 +169,7 @@ ComponentInfo::ComponentInfo(ComponentInfo&& o) :
     all_stat_config_(o.all_stat_config_),
     statLoadLevel(o.statLoadLevel),
     coordinates(std::move(o.coordinates)),
+    local_event_scheduler_(o.local_event_scheduler_),
     subIDIndex(o.subIDIndex),
     slot_name(std::move(o.slot_name)),
     slot_num(o.slot_num),
@@ -325,7 +327,13 @@ ComponentInfo::finalizeLinkConfiguration() const
 {
     if ( nullptr != link_map ) {
         for ( auto& i : link_map->getLinkMap() ) {
-            i.second->finalizeConfiguration();
+            Link* link = i.second;
+            link->finalizeConfiguration();
+            // Self links with handlers send through the local event
+            // scheduler instead of directly to the TimeVortex
+            if ( local_event_scheduler_ && link->pair_link == link && Link::HANDLER == link->type ) {
+                link->send_queue = local_event_scheduler_;
+            }
         }
     }
     for ( auto& s : subComponents ) {
@@ -35,6 +35,10 @@ class ConfigStatistic;
 
 class Simulation_impl;
 
+namespace Core {
+class LocalEventScheduler;
+} // namespace Core
+
 namespace Core::Serialization::pvt {
 class SerializeBaseComponentHelper;
 } // namespace Core::Serialization::pvt
@@ -123,6 +127,13 @@ private:
 
     std::vector<double> coordinates;
 
+    /**
+       Scheduler for the events sent on the self links of this
+       (Sub)Component, or nullptr if the (Sub)Component didn't call
+       enableLocalEventScheduler().  Owned by Simulation_impl.
+     */
+    Core::LocalEventScheduler* local_event_scheduler_ = nullptr;
+
     uint64_t subIDIndex;
 
     // Variables only used by SubComponents
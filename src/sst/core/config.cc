@@ -494,9 +494,33 @@ Config::insertOptions()
         "timeVortex", 0, "MODULE", "Select TimeVortex implementation <lib.timevortex>", timeVortex_, true, true, false);
     DEF_FLAG_OPTVAL("interthread-links", 0, "[EXPERIMENTAL] Set whether or not interthread links should be used",
         interthread_links_, true);
+    DEF_ARG_OPTVAL("batch-dispatch", 0, "MODE",
+        "[EXPERIMENTAL] Execute all events with the same delivery time and priority as a single batch.  Optional mode "
+        "parameters are NONE (default), TIME and HANDLER.  If TIME (or no mode) is specified, events in a batch are "
+        "executed in the normal order.  If HANDLER is specified, events in a batch are grouped by their delivery "
+        "handler, which changes the execution order of events with the same delivery time and priority.",
+        batch_dispatch_, true, true, false);
+    DEF_ARG("rank-sync", 0, "MODE",
+        "[EXPERIMENTAL] Select how ranks synchronize.  Valid modes are SKIP (default), LOOKAHEAD, NEIGHBOR and "
+        "PIPELINED.  SKIP syncs all ranks at the same times, set by the minimum latency of all links between ranks.  "
+        "LOOKAHEAD syncs each rank only with the ranks it has links to, using the minimum latency of the links to each "
+        "one.  NEIGHBOR syncs at the same times as SKIP, but exchanges events with MPI neighborhood collectives and "
+        "combines the global reductions into one.  PIPELINED syncs twice as often as SKIP, but the events sent in each "
+        "sync are not needed until the next one, so ranks keep running while they are in flight.  LOOKAHEAD is ignored "
+        "when checkpoints or a sim-period heartbeat are enabled, and PIPELINED is ignored when checkpoints are enabled.  "
+        "Only SKIP is supported with more than one thread per rank; other modes fall back to it.",
+        rank_sync_, true, false, true);
+    DEF_FLAG_OPTVAL("rank-sync-shmem", 0,
+        "[EXPERIMENTAL] Set whether ranks on the same node exchange events through shared memory instead of MPI.  "
+        "Only used with --rank-sync=SKIP.",
+        rank_sync_shmem_, true, false, true);
 #ifdef USE_MEMPOOL
     DEF_FLAG_OPTVAL("cache-align-mempools", 0, "[EXPERIMENTAL] Set whether mempool allocations are cache aligned",
         cache_align_mempools_, true, true, true);
+    DEF_FLAG_OPTVAL("hugepage-mempools", 0,
+        "[EXPERIMENTAL] Set whether mempool arenas are allocated with 2 MiB huge pages where available and bound to "
+        "the NUMA node of the thread that uses them",
+        hugepage_mempools_, true, true, true);
 #endif
     DEF_ARG("debug-file", 0, "FILE", "File where debug output will go", debugFile_, true, false, true);
     addLibraryPathOptions();
@@ -537,6 +561,13 @@ Config::insertOptions()
         "file to write information about all undeleted events at the end of simulation (STDOUT and STDERR can be used "
         "to output to console)",
         event_dump_file_, true, false, false);
+    DEF_ARG("output-mempool-stats", 0, "FILE",
+        "file to write mempool usage statistics for each size class at the end of simulation (STDOUT and STDERR can "
+        "be used to output to console).  Heartbeats will also include a summary of the statistics.",
+        output_mempool_stats_, true, false, false);
+    DEF_ARG("mempool-profile", 0, "FILE",
+        "[EXPERIMENTAL] Pre-size the mempools using a file written by --output-mempool-stats in an earlier run",
+        mempool_profile_, true, false, false);
 #endif
     DEF_FLAG("force-rank-seq-startup", 0,
         "Force startup phases of simulation to execute one rank at a time for debug purposes", rank_seq_startup_, false,
@@ -368,6 +368,59 @@ private:
         return 0;
     }
 
+    int parse_batch_dispatch(bool& batch_dispatch, bool& batch_dispatch_group, std::string arg)
+    {
+        if ( arg == "" ) {
+            batch_dispatch       = true;
+            batch_dispatch_group = false;
+            return 0;
+        }
+
+        std::string arg_lower(arg);
+        std::locale loc;
+        for ( auto& ch : arg_lower )
+            ch = std::tolower(ch, loc);
+
+        if ( arg_lower == "none" ) {
+            batch_dispatch       = false;
+            batch_dispatch_group = false;
+        }
+        else if ( arg_lower == "time" ) {
+            batch_dispatch       = true;
+            batch_dispatch_group = false;
+        }
+        else if ( arg_lower == "handler" ) {
+            batch_dispatch       = true;
+            batch_dispatch_group = true;
+        }
+        else {
+            fprintf(stderr,
+                "Invalid option '%s' passed to --batch-dispatch.  Valid options are NONE, TIME and HANDLER.\n",
+                arg.c_str());
+            return -1;
+        }
+        return 0;
+    }
+
+    int parse_rank_sync(std::string& rank_sync, std::string arg)
+    {
+        std::string arg_lower(arg);
+        std::locale loc;
+        for ( auto& ch : arg_lower )
+            ch = std::tolower(ch, loc);
+
+        if ( arg_lower != "skip" && arg_lower != "lookahead" && arg_lower != "neighbor" &&
+             arg_lower != "pipelined" ) {
+            fprintf(stderr,
+                "Invalid option '%s' passed to --rank-sync.  Valid options are SKIP, LOOKAHEAD, NEIGHBOR and "
+                "PIPELINED.\n",
+                arg.c_str());
+            return -1;
+        }
+        rank_sync = arg_lower;
+        return 0;
+    }
+
 public:
     std::string parallel_load_str() const
     {
@@ -393,6 +446,52 @@ private:
     */
     SST_CONFIG_DECLARE_OPTION(bool, interthread_links, false, &StandardConfigParsers::flag_default_true);
 
+    /**
+       Batched dispatch
+
+       batch_dispatch - Controls whether the run loop will pop all
+       events with the same delivery time and priority from the
+       TimeVortex at once and execute them back to back.
+
+       batch_dispatch_group - If batched dispatch is on, controls
+       whether the events in each batch are grouped by delivery
+       handler before being executed.  This changes the execution
+       order of events within a batch from the default order.
+    */
+    SST_CONFIG_DECLARE_OPTION_PAIR(bool, batch_dispatch, false, bool, batch_dispatch_group, false,
+        std::bind(
+            &Config::parse_batch_dispatch, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
+
+    /**
+       Algorithm used to synchronize between ranks.  skip syncs all
+       ranks at the same times, lookahead syncs each rank only with
+       the ranks it has links to, neighbor syncs like skip using MPI
+       neighborhood collectives, and pipelined overlaps each exchange
+       with the next sync window.
+    */
+    SST_CONFIG_DECLARE_OPTION(std::string, rank_sync, "skip",
+        std::bind(&Config::parse_rank_sync, this, std::placeholders::_1, std::placeholders::_2));
+
+    /**
+       Exchange events with the ranks on the same node through shared
+       memory instead of MPI.  Only used by the skip rank syncs.
+    */
+    SST_CONFIG_DECLARE_OPTION(bool, rank_sync_shmem, false, &StandardConfigParsers::flag_default_true);
+
+public:
+    /**
+       Returns the string equivalent for batch-dispatch: NONE (if
+       batched dispatch is off), TIME or HANDLER.
+    */
+    std::string batch_dispatch_str() const
+    {
+        if ( !batch_dispatch_.value1 ) return "NONE";
+        if ( batch_dispatch_.value2 ) return "HANDLER";
+        return "TIME";
+    }
+
+private:
+
 
 #ifdef USE_MEMPOOL
     /**
@@ -400,6 +499,12 @@ private:
 
     */
     SST_CONFIG_DECLARE_OPTION(bool, cache_align_mempools, false, &StandardConfigParsers::flag_default_true);
+
+    /**
+       Controls whether mempool arenas are backed by huge pages and
+       bound to the NUMA node of the thread that allocates them
+    */
+    SST_CONFIG_DECLARE_OPTION(bool, hugepage_mempools, false, &StandardConfigParsers::flag_default_true);
 #endif
     /**
        File to which core debug information should be written
@@ -520,6 +625,20 @@ private:
     for mempools in main.cc
     */
     SST_CONFIG_DECLARE_OPTION(std::string, event_dump_file, "", &StandardConfigParsers::from_string<std::string>);
+
+    /**
+       File to output per size class mempool usage statistics at the
+       end of the simulation.  When set, heartbeats also report a
+       summary of the statistics.
+    */
+    SST_CONFIG_DECLARE_OPTION(
+        std::string, output_mempool_stats, "", &StandardConfigParsers::from_string<std::string>);
+
+    /**
+       Mempool statistics file from a previous run used to pre-size
+       the mempools
+    */
+    SST_CONFIG_DECLARE_OPTION(std::string, mempool_profile, "", &StandardConfigParsers::from_string<std::string>);
 #endif
 
     /**
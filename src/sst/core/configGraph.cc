@@ -23,6 +23,7 @@
 #include "sst/core/warnmacros.h"
 
 #include <algorithm>
+#include <cinttypes>
 #include <fstream>
 #include <string>
 #include <utility>
@@ -790,6 +791,19 @@ ConfigGraph::postCreationCleanup()
         count++;
     }
 
+#ifdef __SST_COMPACT_ACTIVITY_KEY__
+    // The compact activity key saturates the order tag, so ties
+    // between events on the links past that are not deterministic
+    if ( links_.size() > Activity::max_order_tag ) {
+        Output::getDefaultObject().output(
+            "WARNING: The compact activity key can only order events on %" PRIu64 " links, but there are %zu.  Events "
+            "with the same delivery time and priority on the other links will be delivered in the order they were "
+            "sent, which may differ from run to run.  Configure without --enable-compact-activity-key to get a "
+            "deterministic order.\n",
+            Activity::max_order_tag, links_.size());
+    }
+#endif
+
     links_.sort();
 
     /* Force component / statistic registration for Group stats */
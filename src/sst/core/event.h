@@ -19,6 +19,7 @@
 #include <atomic>
 #include <cinttypes>
 #include <string>
+#include <typeinfo>
 
 namespace SST {
 
@@ -117,6 +118,14 @@ public:
     /** Clones the event in for the case of a broadcast */
     virtual Event* clone();
 
+    /**
+       Returns sizeof() the event if its class was declared with
+       ImplementTriviallyRelocatableEvent(), otherwise 0.  Used by
+       SST Core to copy the event to another rank without calling
+       serialize_order().
+     */
+    virtual size_t getTriviallyRelocatableSize() const { return 0; }
+
 
 #ifdef __SST_DEBUG_EVENT_TRACKING__
 
@@ -255,6 +264,34 @@ private:
     ImplementVirtualSerializable(SST::Event)
 };
 
+/**
+   Used in place of ImplementSerializable() by Event subclasses whose
+   data members are all trivially copyable, i.e. there are no
+   pointers, strings or containers.  When these events are sent to
+   another rank they are copied byte for byte rather than going
+   through serialize_order(), which is still used for checkpoints.
+
+   A class derived from a trivially relocatable event must use this
+   macro too, otherwise it is serialized the normal way.
+ */
+#ifdef __SST_DEBUG_EVENT_TRACKING__
+// Event tracking adds strings to Event, so no event can be copied
+// byte for byte
+#define ImplementTriviallyRelocatableEvent(...) ImplementSerializable(__VA_ARGS__)
+#else
+#define ImplementTriviallyRelocatableEvent(...)                                          \
+    ImplementSerializable(__VA_ARGS__)                                                   \
+                                                                                         \
+public:                                                                                  \
+    size_t getTriviallyRelocatableSize() const override                                  \
+    {                                                                                    \
+        using relocatable_type = SER_FORWARD_AS_ONE(__VA_ARGS__);                        \
+        return typeid(*this) == typeid(relocatable_type) ? sizeof(relocatable_type) : 0; \
+    }                                                                                    \
+                                                                                         \
+private:
+#endif
+
 /**
  * Empty Event.  Does nothing.
  */
@@ -267,7 +304,7 @@ public:
     ~EmptyEvent() {}
 
 private:
-    ImplementSerializable(SST::EmptyEvent)
+    ImplementTriviallyRelocatableEvent(SST::EmptyEvent)
 };
 
 class EventHandlerMetaData : public AttachPointMetaData
@@ -112,6 +112,14 @@ public:
     */
     unsigned int getGlobalCount() { return global_count_; }
 
+    /**
+       Sets the global ref_count.  Used by RankSyncs that combine the
+       ref_count across ranks without calling check()
+
+       @param count global ref_count
+    */
+    void setGlobalCount(unsigned int count) { global_count_ = count; }
+
     // Exit should not be serialized. It will be created new on
     // restart and Components store there primary component state and
     // reregister with Exit on restart.
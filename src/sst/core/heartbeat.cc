@@ -14,6 +14,7 @@
 #include "sst/core/heartbeat.h"
 
 #include "sst/core/component.h"
+#include "sst/core/config.h"
 #include "sst/core/mempoolAccessor.h"
 #include "sst/core/simulation_impl.h"
 #include "sst/core/sst_mpi.h"
@@ -125,6 +126,13 @@ SimulatorHeartbeat::execute()
             "\tMax Sync data size:              %s\n", global_max_sync_data_size_ua.toStringBestSI().c_str());
         sim_output.output("\tGlobal Sync data size:           %s\n", global_sync_data_size_ua.toStringBestSI().c_str());
     }
+
+#ifdef USE_MEMPOOL
+    if ( Simulation_impl::config.output_mempool_stats() != "" ) {
+        sim_output.output("\tMempool usage by size class on rank %d:\n", rank);
+        Core::MemPoolAccessor::printMemPoolSummary("\t  ", sim_output);
+    }
+#endif
 }
 
 void
@@ -0,0 +1,149 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/clockScheduler.h"
+
+#include "sst/core/clock.h"
+#include "sst/core/simulation_impl.h"
+#include "sst/core/timeVortex.h"
+
+#include <sstream>
+
+namespace SST::Core {
+
+void
+ClockTick::execute()
+{
+    scheduler->tick(this);
+}
+
+std::string
+ClockTick::toString() const
+{
+    std::stringstream buf;
+    buf << "ClockTick to be delivered at " << getDeliveryTime() << " with priority " << getPriority();
+    auto it = scheduler->clock_map_.find(time);
+    if ( it != scheduler->clock_map_.end() ) buf << " for " << it->second.first.size() << " clocks";
+    return buf.str();
+}
+
+
+ClockScheduler::ClockScheduler(Simulation_impl* sim) :
+    sim_(sim)
+{}
+
+ClockScheduler::~ClockScheduler()
+{
+    // Ticks still in the TimeVortex are deleted with it.  Clocks are
+    // owned by Simulation_impl.
+    for ( auto* tick : free_ticks_ ) {
+        delete tick;
+    }
+}
+
+void
+ClockScheduler::insert(SimTime_t time, Clock* clock)
+{
+    TimeStamp_t key(time, clock->getPriority());
+    clock->setDeliveryTime(time);
+
+    auto it = clock_map_.lower_bound(key);
+    if ( it == clock_map_.end() || it->first != key ) {
+        if ( !free_nodes_.empty() ) {
+            ClockMap_t::node_type node = std::move(free_nodes_.back());
+            free_nodes_.pop_back();
+            node.key()                 = key;
+            node.mapped().second       = false;
+            it                         = clock_map_.insert(it, std::move(node));
+        }
+        else {
+            it = clock_map_.emplace_hint(it, key, std::make_pair(ClockList_t(), false));
+        }
+    }
+    it->second.first.push_back(clock);
+
+    scheduleNext();
+}
+
+bool
+ClockScheduler::remove(SimTime_t time, Clock* clock)
+{
+    auto it = clock_map_.find(TimeStamp_t(time, clock->getPriority()));
+    if ( it == clock_map_.end() ) return false;
+
+    ClockList_t& list = it->second.first;
+    for ( auto iter = list.begin(); iter != list.end(); ++iter ) {
+        if ( *iter == clock ) {
+            list.erase(iter);
+            // If there's already a ClockTick for this entry, it will
+            // clean up the empty list when it fires
+            if ( list.empty() && !it->second.second ) {
+                free_nodes_.push_back(clock_map_.extract(it));
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+void
+ClockScheduler::tick(ClockTick* tick)
+{
+    auto it = clock_map_.find(tick->time);
+    if ( it != clock_map_.end() ) {
+        // Take the entry out of the map before calling the clocks.
+        // Each clock will insert itself back into the map for its next
+        // tick.
+        ClockMap_t::node_type node = clock_map_.extract(it);
+        for ( auto* clock : node.mapped().first ) {
+            clock->execute();
+        }
+        node.mapped().first.clear();
+        free_nodes_.push_back(std::move(node));
+    }
+
+    free_ticks_.push_back(tick);
+    scheduleNext();
+}
+
+void
+ClockScheduler::scheduleNext()
+{
+    // Get next entry to schedule.  Iterator maps as follows:
+    // it.first : TimeStamp_t : tick time and priority
+    // it.second.first = ClockList_t : clocks to call
+    // it.second.second = bool : scheduled
+    auto it = clock_map_.begin();
+
+    // If there are no clocks, return
+    if ( it == clock_map_.end() ) return;
+
+    // If first entry is already scheduled, nothing to do
+    if ( it->second.second ) return;
+
+    // Not yet scheduled, put a ClockTick into the TimeVortex
+    ClockTick* tick;
+    if ( !free_ticks_.empty() ) {
+        tick = free_ticks_.back();
+        free_ticks_.pop_back();
+    }
+    else {
+        tick = new ClockTick(this);
+    }
+    tick->time = it->first;
+    tick->setPriority(it->first.second);
+    sim_->insertActivity(it->first.first, tick);
+    it->second.second = true;
+}
+
+} // namespace SST::Core
@@ -0,0 +1,118 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_CLOCKSCHEDULER_H
+#define SST_CORE_IMPL_CLOCKSCHEDULER_H
+
+#include "sst/core/action.h"
+#include "sst/core/sst_types.h"
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace SST {
+
+class Clock;
+class Simulation_impl;
+
+namespace Core {
+
+class ClockScheduler;
+
+/**
+   Action put into the TimeVortex by the ClockScheduler.  Calls all
+   the clocks due at its time and priority.
+ */
+class ClockTick : public Action
+{
+public:
+    using TimeStamp_t = std::pair<SimTime_t, int>;
+
+    ClockTick(ClockScheduler* scheduler) :
+        scheduler(scheduler)
+    {}
+    ~ClockTick() {}
+
+    void execute() override;
+
+    std::string toString() const override;
+
+private:
+    friend class ClockScheduler;
+
+    ClockScheduler* scheduler;
+    TimeStamp_t     time;
+};
+
+
+/**
+   Manages the ticks for all the clocks in the simulation.
+
+   Rather than each Clock putting itself into the TimeVortex every
+   cycle, clocks are kept in a map keyed on (time, priority) of their
+   next tick.  Only the earliest entry in the map has a ClockTick in
+   the TimeVortex, so each time step costs a single TimeVortex insert
+   no matter how many clock domains tick at that time.  Clocks with
+   the same time and priority are called in the order they were
+   scheduled, which is the same order they would have been pulled from
+   the TimeVortex.
+
+   Nothing here needs to be checkpointed; clocks are rescheduled when
+   their handlers are reregistered on restart.
+ */
+class ClockScheduler
+{
+    using TimeStamp_t = ClockTick::TimeStamp_t;
+    using ClockList_t = std::vector<Clock*>;
+    using ClockMap_t  = std::map<TimeStamp_t, std::pair<ClockList_t, bool>>;
+
+public:
+    ClockScheduler(Simulation_impl* sim);
+    ~ClockScheduler();
+
+    /**
+       Schedules clock to tick at time.  The clock's priority is used
+       as the priority of the tick.
+     */
+    void insert(SimTime_t time, Clock* clock);
+
+    /**
+       Removes a clock that was scheduled with insert() and has not yet
+       ticked.  Returns false if the clock wasn't found.
+     */
+    bool remove(SimTime_t time, Clock* clock);
+
+private:
+    friend class ClockTick;
+
+    ClockMap_t       clock_map_;
+    Simulation_impl* sim_ = nullptr;
+
+    // Map nodes and ticks are reused to avoid allocating every tick
+    std::vector<ClockMap_t::node_type> free_nodes_;
+    std::vector<ClockTick*>            free_ticks_;
+
+    /**
+       Schedules the first entry in clock_map_ if it is not already
+       scheduled.
+     */
+    void scheduleNext();
+
+    // Called by ClockTick to call all the clocks due at its time
+    void tick(ClockTick* tick);
+};
+
+} // namespace Core
+} // namespace SST
+
+#endif // SST_CORE_IMPL_CLOCKSCHEDULER_H
@@ -0,0 +1,115 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/linkStorage.h"
+
+#include "sst/core/link.h"
+#include "sst/core/threadsafe.h"
+
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace SST::Core {
+
+namespace {
+
+constexpr size_t slot_size       = sizeof(Link);
+constexpr size_t links_per_chunk = 1024;
+constexpr size_t chunk_size      = slot_size * links_per_chunk;
+
+static_assert(sizeof(SelfLink) == slot_size, "SelfLink must not add data members to Link");
+static_assert(slot_size % alignof(Link) == 0, "Link slots must keep the alignment of Link");
+
+// Slots not yet handed out in the current chunk for this thread, plus
+// slots that have been freed on this thread.  Slots are all the same
+// size, so a Link freed on one thread can be reused by another.
+struct ThreadState
+{
+    char*              next = nullptr;
+    char*              end  = nullptr;
+    std::vector<void*> free_slots;
+};
+
+thread_local ThreadState thread_state;
+
+// All the chunks, so they can be returned at exit
+std::mutex            chunk_lock;
+std::vector<void*>    chunks;
+std::atomic<uint64_t> reserved_bytes(0);
+std::atomic<uint64_t> live_links(0);
+std::atomic<uint64_t> max_live_links(0);
+
+struct ChunkReleaser
+{
+    ~ChunkReleaser()
+    {
+        for ( auto* chunk : chunks ) {
+            ::operator delete(chunk);
+        }
+    }
+} chunk_releaser;
+
+} // namespace
+
+void*
+LinkStorage::allocate(size_t size)
+{
+    if ( size != slot_size ) return ::operator new(size);
+
+    ThreadSafe::atomic_fetch_max(max_live_links, live_links.fetch_add(1, std::memory_order_relaxed) + 1);
+
+    ThreadState& state = thread_state;
+    if ( !state.free_slots.empty() ) {
+        void* ptr = state.free_slots.back();
+        state.free_slots.pop_back();
+        return ptr;
+    }
+
+    if ( state.next == state.end ) {
+        char* chunk = static_cast<char*>(::operator new(chunk_size));
+        {
+            std::lock_guard<std::mutex> lock(chunk_lock);
+            chunks.push_back(chunk);
+        }
+        reserved_bytes.fetch_add(chunk_size, std::memory_order_relaxed);
+        state.next = chunk;
+        state.end  = chunk + chunk_size;
+    }
+
+    void* ptr = state.next;
+    state.next += slot_size;
+    return ptr;
+}
+
+void
+LinkStorage::deallocate(void* ptr, size_t size)
+{
+    if ( nullptr == ptr ) return;
+    if ( size != slot_size ) {
+        ::operator delete(ptr);
+        return;
+    }
+    live_links.fetch_sub(1, std::memory_order_relaxed);
+    thread_state.free_slots.push_back(ptr);
+}
+
+void
+LinkStorage::getUsage(uint64_t& bytes, uint64_t& links)
+{
+    bytes += reserved_bytes.load(std::memory_order_relaxed);
+    links += max_live_links.load(std::memory_order_relaxed);
+}
+
+} // namespace SST::Core
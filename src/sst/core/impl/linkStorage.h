@@ -0,0 +1,55 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_LINKSTORAGE_H
+#define SST_CORE_IMPL_LINKSTORAGE_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace SST::Core {
+
+/**
+   Storage for Link objects.
+
+   Links are created during wire-up and, with very few exceptions,
+   live until the end of the simulation.  Instead of a separate heap
+   allocation per Link, they are carved out of large chunks owned by
+   the thread that creates them, so there is no allocator header or
+   alignment padding per Link.  Links created together, such as the
+   two halves of a LinkPair or the self links of a component, end up
+   next to each other in memory.
+
+   Freed slots are kept on a per-thread free list and reused for the
+   next Link created on that thread.  Chunks are only returned at
+   exit.
+ */
+class LinkStorage
+{
+public:
+    /** Returns storage for an object of size bytes.  Sizes other
+        than the slot size are passed to the global operator new. */
+    static void* allocate(size_t size);
+
+    /** Returns storage obtained from allocate() */
+    static void deallocate(void* ptr, size_t size);
+
+    /**
+       Gets the bytes reserved for Links on this rank and the most
+       Links that were allocated at one time.  Bytes and links are
+       added to the values passed into the function.
+     */
+    static void getUsage(uint64_t& bytes, uint64_t& links);
+};
+
+} // namespace SST::Core
+
+#endif // SST_CORE_IMPL_LINKSTORAGE_H
@@ -0,0 +1,128 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/localEventScheduler.h"
+
+#include "sst/core/simulation_impl.h"
+#include "sst/core/timeVortex.h"
+
+#include <algorithm>
+#include <sstream>
+
+namespace SST::Core {
+
+void
+LocalEventTick::execute()
+{
+    scheduler->deliver(this);
+}
+
+std::string
+LocalEventTick::toString() const
+{
+    std::stringstream buf;
+    buf << "LocalEventTick to be delivered at " << getDeliveryTime() << " with priority " << getPriority()
+        << " and order tag " << getOrderTag();
+    return buf.str();
+}
+
+
+LocalEventScheduler::LocalEventScheduler(Simulation_impl* sim) :
+    sim_(sim)
+{}
+
+LocalEventScheduler::~LocalEventScheduler()
+{
+    // Ticks still in the TimeVortex are deleted with it
+    for ( auto* event : events ) {
+        delete event;
+    }
+    for ( auto* tick : free_ticks_ ) {
+        delete tick;
+    }
+}
+
+void
+LocalEventScheduler::insert(Activity* activity)
+{
+#ifdef __SST_COMPACT_ACTIVITY_KEY__
+    if ( UNLIKELY(send_order_ != 0 && (send_order_ & Activity::queue_order_mask) == 0) ) renumberSendOrder();
+#endif
+    activity->setQueueOrder(send_order_++);
+    events.push_back(activity);
+    std::push_heap(events.begin(), events.end(), EventCompare_t());
+
+    // The earliest pending event always has a tick, so a new tick is
+    // only needed if this event is now the earliest
+    if ( events.front() == activity ) schedule(activity);
+}
+
+void
+LocalEventScheduler::getContents(std::vector<Activity*>& activities) const
+{
+    activities.insert(activities.end(), events.begin(), events.end());
+}
+
+void
+LocalEventScheduler::schedule(Activity* event)
+{
+    LocalEventTick* tick;
+    if ( !free_ticks_.empty() ) {
+        tick = free_ticks_.back();
+        free_ticks_.pop_back();
+    }
+    else {
+        tick = new LocalEventTick(this);
+    }
+    tick->event = event;
+    tick->copyAllDeliveryInfo(event);
+    ticks_.push_back(tick);
+    sim_->getTimeVortex()->insert(tick);
+}
+
+void
+LocalEventScheduler::deliver(LocalEventTick* tick)
+{
+    // Ticks fire in the order they were scheduled in reverse, and the
+    // earliest tick always belongs to the earliest pending event
+    ticks_.pop_back();
+    std::pop_heap(events.begin(), events.end(), EventCompare_t());
+    Activity* event = events.back();
+    events.pop_back();
+
+    tick->event = nullptr;
+    free_ticks_.push_back(tick);
+
+    if ( !events.empty() && (ticks_.empty() || ticks_.back()->event != events.front()) ) {
+        schedule(events.front());
+    }
+
+    event->execute();
+}
+
+#ifdef __SST_COMPACT_ACTIVITY_KEY__
+void
+LocalEventScheduler::renumberSendOrder()
+{
+    std::sort(events.begin(), events.end(), [](const Activity* lhs, const Activity* rhs) {
+        return EventCompare_t()(rhs, lhs);
+    });
+    send_order_ = 0;
+    for ( auto* event : events ) {
+        event->setQueueOrder(send_order_++);
+    }
+    std::make_heap(events.begin(), events.end(), EventCompare_t());
+}
+#endif
+
+} // namespace SST::Core
@@ -0,0 +1,138 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_LOCALEVENTSCHEDULER_H
+#define SST_CORE_IMPL_LOCALEVENTSCHEDULER_H
+
+#include "sst/core/action.h"
+#include "sst/core/activity.h"
+#include "sst/core/activityQueue.h"
+#include "sst/core/sst_types.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace SST {
+
+class Simulation_impl;
+
+namespace Core {
+
+class LocalEventScheduler;
+
+/**
+   Action put into the TimeVortex by a LocalEventScheduler.  It has
+   the same delivery time, priority and order tag as the event it
+   stands in for and delivers that event when it executes.
+ */
+class LocalEventTick : public Action
+{
+public:
+    explicit LocalEventTick(LocalEventScheduler* scheduler) :
+        scheduler(scheduler)
+    {}
+    ~LocalEventTick() {}
+
+    void execute() override;
+
+    std::string toString() const override;
+
+private:
+    friend class LocalEventScheduler;
+
+    LocalEventScheduler* scheduler;
+    Activity*            event = nullptr;
+};
+
+
+/**
+   Holds the pending events sent on the self links of a single
+   component (see BaseComponent::enableLocalEventScheduler()).
+
+   The scheduler is installed as the send queue of the component's
+   self links that have handlers when the links are finalized, so
+   their events are kept in a small local heap instead of the
+   TimeVortex.  Only the earliest pending event has a LocalEventTick
+   in the TimeVortex; sending an event that isn't earlier than the
+   one already ticked costs no TimeVortex operation.  A second tick is
+   only added when an event is sent that is earlier than every event
+   already ticked.
+
+   Ticks carry the delivery time, priority and order tag of their
+   event, so they are ordered against the rest of the TimeVortex by
+   the same rules as the events.  Events on the scheduler with the
+   same time, priority and order tag are delivered in the order they
+   were sent.
+ */
+class LocalEventScheduler : public ActivityQueue
+{
+public:
+    explicit LocalEventScheduler(Simulation_impl* sim);
+    ~LocalEventScheduler();
+
+    /** Returns true if there are no pending events */
+    bool empty() override { return events.empty(); }
+
+    /** Returns the number of pending events */
+    int size() override { return events.size(); }
+
+    /** Adds an event sent on one of the links */
+    void insert(Activity* activity) override;
+
+    /** Not supported */
+    Activity* pop() override { return nullptr; }
+
+    /** Not supported */
+    Activity* front() override { return nullptr; }
+
+    /**
+       Appends the pending events to activities.  Used to include them
+       when checkpointing the contents of the TimeVortex.
+     */
+    void getContents(std::vector<Activity*>& activities) const;
+
+private:
+    friend class LocalEventTick;
+
+    // Events use their queue order to hold the order they were sent
+    // while they are in the scheduler.  The heap is kept with
+    // std::push_heap()/std::pop_heap() so that the pending events can
+    // be walked for checkpointing.
+    using EventCompare_t = Activity::greater<true, true, true>;
+
+    Simulation_impl*       sim_;
+    uint64_t               send_order_ = 0;
+    std::vector<Activity*> events;
+
+    // Ticks in the TimeVortex, latest first.  A new tick is always
+    // earlier than the ones already there, so the earliest is at the
+    // back.
+    std::vector<LocalEventTick*> ticks_;
+    std::vector<LocalEventTick*> free_ticks_;
+
+#ifdef __SST_COMPACT_ACTIVITY_KEY__
+    // Renumbers the send order of the pending events before it
+    // overflows the queue order field
+    void renumberSendOrder();
+#endif
+
+    // Puts a tick for event into the TimeVortex
+    void schedule(Activity* event);
+
+    // Called by LocalEventTick to deliver its event
+    void deliver(LocalEventTick* tick);
+};
+
+} // namespace Core
+} // namespace SST
+
+#endif // SST_CORE_IMPL_LOCALEVENTSCHEDULER_H
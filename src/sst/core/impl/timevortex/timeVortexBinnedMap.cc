@@ -79,7 +79,15 @@ template <bool TS>
 void
 TimeVortexBinnedMapBase<TS>::insert(Activity* activity)
 {
-    activity->setQueueOrder(insertOrder++);
+    // The thread safe version uses an atomic counter and can't
+    // renumber the pending activities when the compact activity key
+    // wraps (see TimeVortex::assignQueueOrder())
+    if constexpr ( TS ) {
+        activity->setQueueOrder(insertOrder++);
+    }
+    else {
+        assignQueueOrder(activity, insertOrder);
+    }
     SimTime_t sort_time = activity->getDeliveryTime();
 
     current_depth++;
@@ -170,6 +178,19 @@ TimeVortexBinnedMapBase<TS>::print(Output& out) const
     // Still need to figure out a reasonable way to print the state
 }
 
+template <bool TS>
+void
+TimeVortexBinnedMapBase<TS>::getContents(std::vector<Activity*>& activities) const
+{
+    activities.clear();
+    auto& current = current_time_unit->getActivities();
+    activities.insert(activities.end(), current.begin(), current.end());
+    for ( auto& entry : map ) {
+        auto& unit = entry.second->getActivities();
+        activities.insert(activities.end(), unit.begin(), unit.end());
+    }
+}
+
 
 class TimeVortexBinnedMap : public TimeVortexBinnedMapBase<false>
 {
@@ -199,8 +220,8 @@ public:
         "timevortex.map.binned.ts",
         SST_ELI_ELEMENT_VERSION(1,0,0),
         "[EXPERIMENTAL] Thread-safe verion of TimeVortex based on std::map with events binned into time buckets."
-        "  Do not reference this element directly; just specify sst.timevortex.map.binned and this version will"
-        " be selected when it is needed based on other parameters.")
+        "  Only needed if specified with --interthread-links, in which case events from other threads are inserted"
+        " directly instead of going through the thread sync.")
 
     explicit TimeVortexBinnedMap_ts(Params& params) :
         TimeVortexBinnedMapBase<true>(params)
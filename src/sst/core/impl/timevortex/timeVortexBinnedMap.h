@@ -87,6 +87,8 @@ private:
         inline SimTime_t getSortTime() { return sort_time; }
         inline void      setSortTime(SimTime_t time) { sort_time = time; }
 
+        inline const std::vector<Activity*>& getActivities() const { return activities; }
+
 
         // Inserts can happen by multiple threads
         void insert(Activity* act)
@@ -149,9 +151,7 @@ public:
     uint64_t getCurrentDepth() const override { return current_depth; }
     uint64_t getMaxDepth() const override { return max_depth; }
 
-    // TODO: Implement getContents(). For now, just return an empty
-    // vector.
-    void getContents(std::vector<Activity*>& UNUSED(activities)) const override {}
+    void getContents(std::vector<Activity*>& activities) const override;
 
 private:
     // Should only ever be accessed by the "active" thread.  Not safe
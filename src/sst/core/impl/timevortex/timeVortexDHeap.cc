@@ -0,0 +1,285 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/timevortex/timeVortexDHeap.h"
+
+#include "sst/core/output.h"
+
+namespace SST::IMPL {
+
+template <bool TS>
+TimeVortexDHeapBase<TS>::TimeVortexDHeapBase(Params& UNUSED(params)) :
+    TimeVortex(),
+    insertOrder(0),
+    max_depth(0),
+    current_depth(0)
+{}
+
+template <bool TS>
+TimeVortexDHeapBase<TS>::~TimeVortexDHeapBase()
+{
+    // Activities in TimeVortexDHeap all need to be deleted
+    for ( auto& entry : data ) {
+        delete entry.activity;
+    }
+    data.clear();
+}
+
+template <bool TS>
+bool
+TimeVortexDHeapBase<TS>::empty()
+{
+    if ( TS ) slock.lock();
+    auto ret = data.empty();
+    if ( TS ) slock.unlock();
+    return ret;
+}
+
+template <bool TS>
+int
+TimeVortexDHeapBase<TS>::size()
+{
+    if ( TS ) slock.lock();
+    auto ret = data.size();
+    if ( TS ) slock.unlock();
+    return ret;
+}
+
+template <bool TS>
+void
+TimeVortexDHeapBase<TS>::insert(Activity* activity)
+{
+    if ( TS ) slock.lock();
+    assignQueueOrder(activity, insertOrder);
+    data.emplace_back();
+    siftUp(data.size() - 1, makeEntry(activity));
+
+    current_depth++;
+    if ( current_depth > max_depth ) {
+        max_depth = current_depth;
+    }
+    if ( TS ) slock.unlock();
+}
+
+template <bool TS>
+void
+TimeVortexDHeapBase<TS>::insertBatch(Activity** begin, size_t n)
+{
+    if ( TS ) slock.lock();
+    size_t old_size = data.size();
+    data.reserve(old_size + n);
+
+    if ( n > old_size ) {
+        // The batch is at least as big as the existing heap, so just
+        // append everything and rebuild the heap bottom up
+        for ( size_t i = 0; i < n; ++i ) {
+            assignQueueOrder(begin[i], insertOrder);
+            data.push_back(makeEntry(begin[i]));
+        }
+        if ( data.size() > 1 ) {
+            for ( size_t i = (data.size() - 2) / arity_ + 1; i-- > 0; ) {
+                Entry entry = data[i];
+                siftDown(i, entry);
+            }
+        }
+    }
+    else {
+        for ( size_t i = 0; i < n; ++i ) {
+            assignQueueOrder(begin[i], insertOrder);
+            data.emplace_back();
+            siftUp(data.size() - 1, makeEntry(begin[i]));
+        }
+    }
+
+    current_depth += n;
+    if ( current_depth > max_depth ) {
+        max_depth = current_depth;
+    }
+    if ( TS ) slock.unlock();
+}
+
+template <bool TS>
+Activity*
+TimeVortexDHeapBase<TS>::pop()
+{
+    if ( TS ) slock.lock();
+    if ( data.empty() ) {
+        if ( TS ) slock.unlock();
+        return nullptr;
+    }
+    Activity* ret_val = popTop();
+    current_depth--;
+    if ( TS ) slock.unlock();
+    return ret_val;
+}
+
+template <bool TS>
+Activity*
+TimeVortexDHeapBase<TS>::front()
+{
+    if ( TS ) slock.lock();
+    Activity* ret_val = data.empty() ? nullptr : data.front().activity;
+    if ( TS ) slock.unlock();
+    return ret_val;
+}
+
+template <bool TS>
+void
+TimeVortexDHeapBase<TS>::popBatch(std::vector<Activity*>& batch)
+{
+    if ( TS ) slock.lock();
+    if ( data.empty() ) {
+        if ( TS ) slock.unlock();
+        return;
+    }
+    size_t    start = batch.size();
+    Activity* first = popTop();
+    batch.push_back(first);
+    if ( first->isEvent() ) {
+        while ( !data.empty() && sameBatch(first, data.front().activity) ) {
+            batch.push_back(popTop());
+        }
+    }
+    current_depth -= batch.size() - start;
+    if ( TS ) slock.unlock();
+}
+
+template <bool TS>
+Activity*
+TimeVortexDHeapBase<TS>::popTop()
+{
+    Activity* ret_val = data.front().activity;
+    Entry     last    = data.back();
+    data.pop_back();
+    if ( !data.empty() ) siftDown(0, last);
+    return ret_val;
+}
+
+template <bool TS>
+void
+TimeVortexDHeapBase<TS>::siftUp(size_t index, const Entry& entry)
+{
+    // Move the hole up until we find the spot for entry
+    while ( index > 0 ) {
+        size_t parent = (index - 1) / arity_;
+        if ( !(entry < data[parent]) ) break;
+        data[index] = data[parent];
+        index       = parent;
+    }
+    data[index] = entry;
+}
+
+template <bool TS>
+void
+TimeVortexDHeapBase<TS>::siftDown(size_t index, const Entry& entry)
+{
+    // Move the hole down until we find the spot for entry
+    size_t count = data.size();
+    while ( true ) {
+        size_t first = index * arity_ + 1;
+        if ( first >= count ) break;
+
+        // Find the smallest child
+        size_t last     = first + arity_ < count ? first + arity_ : count;
+        size_t smallest = first;
+        for ( size_t child = first + 1; child < last; ++child ) {
+            if ( data[child] < data[smallest] ) smallest = child;
+        }
+
+        if ( !(data[smallest] < entry) ) break;
+        data[index] = data[smallest];
+        index       = smallest;
+    }
+    data[index] = entry;
+}
+
+template <bool TS>
+void
+TimeVortexDHeapBase<TS>::dbg_print(Output& out) const
+{
+    out.output("TimeVortex state:\n");
+
+    for ( auto& entry : data ) {
+        entry.activity->print("  ", out);
+    }
+}
+
+template <bool TS>
+void
+TimeVortexDHeapBase<TS>::getContents(std::vector<Activity*>& activities) const
+{
+    activities.clear();
+    activities.reserve(data.size());
+    for ( auto& entry : data ) {
+        activities.push_back(entry.activity);
+    }
+}
+
+#ifdef __SST_COMPACT_ACTIVITY_KEY__
+template <bool TS>
+uint64_t
+TimeVortexDHeapBase<TS>::renumberQueueOrder()
+{
+    // Renumbering keeps the relative order, so the heap is still
+    // valid once the entries are refreshed
+    uint64_t next = TimeVortex::renumberQueueOrder();
+    for ( auto& entry : data ) {
+        entry = makeEntry(entry.activity);
+    }
+    return next;
+}
+#endif
+
+class TimeVortexDHeap : public TimeVortexDHeapBase<false>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexDHeap,
+        "sst",
+        "timevortex.dheap",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "TimeVortex based on a 4-ary heap that stores the ordering keys inline with the Activity pointers.")
+
+    explicit TimeVortexDHeap(Params& params) :
+        TimeVortexDHeapBase<false>(params)
+    {}
+    TimeVortexDHeap() = delete;
+    ~TimeVortexDHeap() {}
+
+    SST_ELI_EXPORT(TimeVortexDHeap)
+};
+
+class TimeVortexDHeap_ts : public TimeVortexDHeapBase<true>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexDHeap_ts,
+        "sst",
+        "timevortex.dheap.ts",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Thread-safe verion of TimeVortex based on a 4-ary heap."
+        "  Only needed if specified with --interthread-links, in which case events from other threads are inserted"
+        " directly instead of going through the thread sync.")
+
+    explicit TimeVortexDHeap_ts(Params& params) :
+        TimeVortexDHeapBase<true>(params)
+    {}
+    TimeVortexDHeap_ts() = delete;
+    ~TimeVortexDHeap_ts() {}
+
+    SST_ELI_EXPORT(TimeVortexDHeap_ts)
+};
+
+} // namespace SST::IMPL
@@ -0,0 +1,154 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXDHEAP_H
+#define SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXDHEAP_H
+
+#include "sst/core/activity.h"
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/threadsafe.h"
+#include "sst/core/timeVortex.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace SST {
+
+class Output;
+
+namespace IMPL {
+
+/**
+ * Primary Event Queue based on a d-ary min-heap of packed ordering
+ * records.
+ *
+ * Each entry in the heap holds a copy of the delivery time, priority
+ * and order tag, and queue order of the Activity along with the
+ * pointer to the Activity.  Comparisons during sift operations only
+ * touch the contiguous heap array and never dereference the Activity
+ * itself, which avoids a cache miss per comparison when the queue is
+ * deep.  Using a 4-ary heap keeps all the children of a node within
+ * two cache lines and halves the height of the heap compared to a
+ * binary heap.
+ */
+template <bool TS>
+class TimeVortexDHeapBase : public TimeVortex
+{
+
+public:
+    explicit TimeVortexDHeapBase(Params& params);
+    TimeVortexDHeapBase() = delete;
+    ~TimeVortexDHeapBase();
+
+    bool      empty() override;
+    int       size() override;
+    void      insert(Activity* activity) override;
+    void      insertBatch(Activity** begin, size_t n) override;
+    Activity* pop() override;
+    Activity* front() override;
+    void      popBatch(std::vector<Activity*>& batch) override;
+
+    uint64_t getCurrentDepth() const override { return current_depth; }
+    uint64_t getMaxDepth() const override { return max_depth; }
+
+    void dbg_print(Output& out) const override;
+
+    void getContents(std::vector<Activity*>& activities) const override;
+
+private:
+    // Number of children for each node in the heap
+    static constexpr size_t arity_ = 4;
+
+#ifdef __SST_COMPACT_ACTIVITY_KEY__
+    struct Entry
+    {
+        SimTime_t time;
+        uint64_t  order_key;
+        Activity* activity;
+
+        /** Returns true if this entry should be delivered before rhs */
+        inline bool operator<(const Entry& rhs) const
+        {
+            return ((static_cast<Activity::uint128_t>(time) << 64) | order_key) <
+                   ((static_cast<Activity::uint128_t>(rhs.time) << 64) | rhs.order_key);
+        }
+    };
+
+    // Build the heap entry for an activity
+    static inline Entry makeEntry(Activity* activity)
+    {
+        Entry entry;
+        entry.time      = activity->getDeliveryTime();
+        entry.order_key = static_cast<uint64_t>(activity->getOrderingKey<false, true, true>());
+        entry.activity  = activity;
+        return entry;
+    }
+
+    // The entries cache the ordering key, so they need to be rebuilt
+    // after renumbering
+    uint64_t renumberQueueOrder() override;
+#else
+    struct Entry
+    {
+        SimTime_t time;
+        uint64_t  priority_order;
+        uint64_t  queue_order;
+        Activity* activity;
+
+        /** Returns true if this entry should be delivered before rhs */
+        inline bool operator<(const Entry& rhs) const
+        {
+            if ( time != rhs.time ) return time < rhs.time;
+            if ( priority_order != rhs.priority_order ) return priority_order < rhs.priority_order;
+            return queue_order < rhs.queue_order;
+        }
+    };
+
+    // Build the heap entry for an activity
+    static inline Entry makeEntry(Activity* activity)
+    {
+        // Rebuild the full priority/order tag value used by
+        // Activity::greater from its two halves
+        Entry entry;
+        entry.time           = activity->getDeliveryTime();
+        entry.priority_order = (static_cast<uint64_t>(static_cast<uint32_t>(activity->getPriority())) << 32) |
+                               static_cast<uint64_t>(activity->getOrderTag());
+        entry.queue_order    = activity->getQueueOrder();
+        entry.activity       = activity;
+        return entry;
+    }
+#endif
+
+    // Remove the top of the heap, no locking.  Heap must not be empty.
+    Activity* popTop();
+
+    void siftUp(size_t index, const Entry& entry);
+    void siftDown(size_t index, const Entry& entry);
+
+    // Data
+    std::vector<Entry> data;
+    uint64_t           insertOrder;
+
+    // Stats about usage
+    uint64_t max_depth;
+
+    // Need current depth to be atomic if we are thread safe
+    std::conditional_t<TS, std::atomic<uint64_t>, uint64_t> current_depth;
+
+    CACHE_ALIGNED(SST::Core::ThreadSafe::Spinlock, slock);
+};
+
+} // namespace IMPL
+} // namespace SST
+
+#endif // SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXDHEAP_H
@@ -0,0 +1,342 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/timevortex/timeVortexLadder.h"
+
+#include "sst/core/output.h"
+
+#include <algorithm>
+
+namespace SST::IMPL {
+
+template <bool TS>
+TimeVortexLadderBase<TS>::TimeVortexLadderBase(Params& UNUSED(params)) :
+    TimeVortex(),
+    top_boundary(0),
+    num_rungs(0),
+    insertOrder(0),
+    max_depth(0),
+    current_depth(0)
+{
+    // Reserve all the rungs up front so that references to rungs
+    // stay valid while spawning a new rung
+    rungs.reserve(max_rungs_);
+}
+
+template <bool TS>
+TimeVortexLadderBase<TS>::~TimeVortexLadderBase()
+{
+    // Activities in TimeVortexLadder all need to be deleted
+    std::vector<Activity*> contents;
+    getContents(contents);
+    for ( auto* act : contents ) {
+        delete act;
+    }
+}
+
+template <bool TS>
+bool
+TimeVortexLadderBase<TS>::empty()
+{
+    if ( TS ) slock.lock();
+    auto ret = current_depth == 0;
+    if ( TS ) slock.unlock();
+    return ret;
+}
+
+template <bool TS>
+int
+TimeVortexLadderBase<TS>::size()
+{
+    return current_depth;
+}
+
+template <bool TS>
+void
+TimeVortexLadderBase<TS>::insert(Activity* activity)
+{
+    if ( TS ) slock.lock();
+    assignQueueOrder(activity, insertOrder);
+    insert_int(activity);
+    current_depth++;
+    if ( current_depth > max_depth ) {
+        max_depth = current_depth;
+    }
+    if ( TS ) slock.unlock();
+}
+
+template <bool TS>
+void
+TimeVortexLadderBase<TS>::insertBatch(Activity** begin, size_t n)
+{
+    if ( TS ) slock.lock();
+    for ( size_t i = 0; i < n; ++i ) {
+        assignQueueOrder(begin[i], insertOrder);
+        insert_int(begin[i]);
+    }
+    current_depth += n;
+    if ( current_depth > max_depth ) {
+        max_depth = current_depth;
+    }
+    if ( TS ) slock.unlock();
+}
+
+template <bool TS>
+Activity*
+TimeVortexLadderBase<TS>::pop()
+{
+    if ( TS ) slock.lock();
+    if ( bottom.empty() && !refill() ) {
+        if ( TS ) slock.unlock();
+        return nullptr;
+    }
+    Activity* ret_val = bottom.back();
+    bottom.pop_back();
+    current_depth--;
+    if ( TS ) slock.unlock();
+    return ret_val;
+}
+
+template <bool TS>
+Activity*
+TimeVortexLadderBase<TS>::front()
+{
+    if ( TS ) slock.lock();
+    Activity* ret_val = nullptr;
+    if ( !bottom.empty() || refill() ) {
+        ret_val = bottom.back();
+    }
+    if ( TS ) slock.unlock();
+    return ret_val;
+}
+
+template <bool TS>
+void
+TimeVortexLadderBase<TS>::popBatch(std::vector<Activity*>& batch)
+{
+    if ( TS ) slock.lock();
+    if ( bottom.empty() && !refill() ) {
+        if ( TS ) slock.unlock();
+        return;
+    }
+    // All activities with the same delivery time as the back of
+    // bottom are in bottom, so no refill is needed inside the loop
+    size_t    start = batch.size();
+    Activity* first = bottom.back();
+    bottom.pop_back();
+    batch.push_back(first);
+    if ( first->isEvent() ) {
+        while ( !bottom.empty() && sameBatch(first, bottom.back()) ) {
+            batch.push_back(bottom.back());
+            bottom.pop_back();
+        }
+    }
+    current_depth -= batch.size() - start;
+    if ( TS ) slock.unlock();
+}
+
+template <bool TS>
+void
+TimeVortexLadderBase<TS>::getContents(std::vector<Activity*>& activities) const
+{
+    activities.clear();
+    activities.insert(activities.end(), bottom.begin(), bottom.end());
+    for ( size_t i = 0; i < num_rungs; ++i ) {
+        for ( auto& bucket : rungs[i].buckets ) {
+            activities.insert(activities.end(), bucket.begin(), bucket.end());
+        }
+    }
+    activities.insert(activities.end(), top.begin(), top.end());
+}
+
+template <bool TS>
+void
+TimeVortexLadderBase<TS>::insert_int(Activity* activity)
+{
+    SimTime_t sort_time = activity->getDeliveryTime();
+
+    // Far future events go into top unsorted
+    if ( sort_time > top_boundary ) {
+        top.push_back(activity);
+        return;
+    }
+
+    // Look for the coarsest rung that covers this time
+    for ( size_t i = 0; i < num_rungs; ++i ) {
+        Rung& rung = rungs[i];
+        if ( rung.active() && sort_time >= rung.curStart() ) {
+            rung.buckets[(sort_time - rung.start) / rung.width].push_back(activity);
+            rung.count++;
+            return;
+        }
+    }
+
+    // Goes into bottom.  Bottom is sorted with the latest activity
+    // first, so upper_bound gives us the position of the first
+    // activity that will be delivered before this one.
+    auto it = std::upper_bound(bottom.begin(), bottom.end(), activity, Activity::greater<true, true, true>());
+    bottom.insert(it, activity);
+
+    // Inserting into bottom is linear, so if bottom gets too big,
+    // move it into a new finest rung.  The rung needs to cover
+    // everything up to where the next coarser tier starts.
+    if ( bottom.size() > thresh_ && num_rungs < max_rungs_ &&
+         bottom.front()->getDeliveryTime() != bottom.back()->getDeliveryTime() ) {
+        SimTime_t start = bottom.back()->getDeliveryTime();
+        SimTime_t end   = num_rungs > 0 ? rungs[num_rungs - 1].curStart() - 1 : top_boundary;
+        spawnRung(start, end, bottom);
+    }
+}
+
+template <bool TS>
+bool
+TimeVortexLadderBase<TS>::refill()
+{
+    while ( bottom.empty() ) {
+        // Drop any rungs that no longer hold activities, starting
+        // with the finest.  Bottom will then cover their time range.
+        while ( num_rungs > 0 && rungs[num_rungs - 1].count == 0 ) {
+            num_rungs--;
+        }
+
+        if ( num_rungs == 0 ) {
+            if ( top.empty() ) return false;
+
+            // Move the earliest activities in top down into the
+            // lower tiers.  Rather than moving all of top, split at
+            // the 3/4 quantile so that far future outliers (e.g. the
+            // StopAction at SST_SIMTIME_MAX) don't stretch the bucket
+            // width of the new rung.
+            size_t q = (top.size() - 1) * 3 / 4;
+            std::nth_element(top.begin(), top.begin() + q, top.end(), Activity::less<true, false, false>());
+            SimTime_t end = top[q]->getDeliveryTime();
+
+            auto mid = std::partition(
+                top.begin(), top.end(), [end](const Activity* act) { return act->getDeliveryTime() <= end; });
+
+            std::vector<Activity*> acts(top.begin(), mid);
+            top.erase(top.begin(), mid);
+            top_boundary = end;
+
+            SimTime_t start = end;
+            for ( auto* act : acts ) {
+                if ( act->getDeliveryTime() < start ) start = act->getDeliveryTime();
+            }
+
+            if ( acts.size() <= thresh_ || start == end ) {
+                fillBottom(acts);
+            }
+            else {
+                spawnRung(start, end, acts);
+            }
+            continue;
+        }
+
+        // Dequeue the next non-empty bucket from the finest rung
+        Rung& rung = rungs[num_rungs - 1];
+        while ( rung.buckets[rung.cur].empty() ) {
+            rung.cur++;
+        }
+
+        size_t    index  = rung.cur++;
+        auto&     bucket = rung.buckets[index];
+        SimTime_t start  = rung.start + index * rung.width;
+        SimTime_t end    = (index == rung.buckets.size() - 1) ? rung.end : start + rung.width - 1;
+        rung.count -= bucket.size();
+
+        if ( bucket.size() <= thresh_ || start == end || num_rungs == max_rungs_ ) {
+            fillBottom(bucket);
+        }
+        else {
+            spawnRung(start, end, bucket);
+        }
+    }
+    return true;
+}
+
+template <bool TS>
+void
+TimeVortexLadderBase<TS>::fillBottom(std::vector<Activity*>& acts)
+{
+    // Bottom is empty, so just take over the storage and sort
+    bottom.swap(acts);
+    std::sort(bottom.begin(), bottom.end(), Activity::greater<true, true, true>());
+}
+
+template <bool TS>
+void
+TimeVortexLadderBase<TS>::spawnRung(SimTime_t start, SimTime_t end, std::vector<Activity*>& acts)
+{
+    // Target roughly one activity per bucket
+    size_t    target = std::min(acts.size(), max_bucket_);
+    SimTime_t width  = (end - start) / target + 1;
+
+    if ( num_rungs == rungs.size() ) rungs.emplace_back();
+    Rung& rung = rungs[num_rungs++];
+
+    rung.start = start;
+    rung.end   = end;
+    rung.width = width;
+    rung.cur   = 0;
+    rung.count = acts.size();
+    rung.buckets.resize((end - start) / width + 1);
+
+    for ( auto* act : acts ) {
+        rung.buckets[(act->getDeliveryTime() - start) / width].push_back(act);
+    }
+    acts.clear();
+}
+
+class TimeVortexLadder : public TimeVortexLadderBase<false>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexLadder,
+        "sst",
+        "timevortex.ladder",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "TimeVortex based on a ladder queue with O(1) amortized insert and pop.")
+
+    explicit TimeVortexLadder(Params& params) :
+        TimeVortexLadderBase<false>(params)
+    {}
+    TimeVortexLadder() = delete;
+    ~TimeVortexLadder() {}
+
+    SST_ELI_EXPORT(TimeVortexLadder)
+};
+
+class TimeVortexLadder_ts : public TimeVortexLadderBase<true>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexLadder_ts,
+        "sst",
+        "timevortex.ladder.ts",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Thread-safe verion of TimeVortex based on a ladder queue."
+        "  Only needed if specified with --interthread-links, in which case events from other threads are inserted"
+        " directly instead of going through the thread sync.")
+
+    explicit TimeVortexLadder_ts(Params& params) :
+        TimeVortexLadderBase<true>(params)
+    {}
+    TimeVortexLadder_ts() = delete;
+    ~TimeVortexLadder_ts() {}
+
+    SST_ELI_EXPORT(TimeVortexLadder_ts)
+};
+
+} // namespace SST::IMPL
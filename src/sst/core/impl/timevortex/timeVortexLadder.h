@@ -0,0 +1,147 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXLADDER_H
+#define SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXLADDER_H
+
+#include "sst/core/activity.h"
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/threadsafe.h"
+#include "sst/core/timeVortex.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace SST {
+
+class Output;
+
+namespace IMPL {
+
+/**
+ * Primary Event Queue based on a ladder queue (Tang, Goh and Thng,
+ * "Ladder Queue: An O(1) Priority Queue Structure for Large-Scale
+ * Discrete Event Simulation").
+ *
+ * The queue is split into three tiers:
+ *
+ *  - top: an unsorted vector holding all activities later than
+ *    top_boundary.  Inserts into the far future are O(1).  When the
+ *    lower tiers run dry, the earliest part of top is moved down.
+ *
+ *  - rungs: a stack of bucket arrays.  Each rung covers a contiguous
+ *    range of time split into equal width buckets (binned on
+ *    delivery time only).  Each finer rung covers exactly one bucket
+ *    of the rung above it.
+ *
+ *  - bottom: a small vector, sorted using the full
+ *    Activity::greater<true, true, true> comparison, that holds the
+ *    activities which will be popped next.
+ *
+ * Buckets are only sorted when they are moved into bottom, so the
+ * ordering seen by pop() is identical to the other TimeVortex
+ * implementations.
+ */
+template <bool TS>
+class TimeVortexLadderBase : public TimeVortex
+{
+
+public:
+    explicit TimeVortexLadderBase(Params& params);
+    TimeVortexLadderBase() = delete;
+    ~TimeVortexLadderBase();
+
+    bool      empty() override;
+    int       size() override;
+    void      insert(Activity* activity) override;
+    void      insertBatch(Activity** begin, size_t n) override;
+    Activity* pop() override;
+    Activity* front() override;
+    void      popBatch(std::vector<Activity*>& batch) override;
+
+    uint64_t getCurrentDepth() const override { return current_depth; }
+    uint64_t getMaxDepth() const override { return max_depth; }
+
+    void getContents(std::vector<Activity*>& activities) const override;
+
+private:
+    // A bucket with this many or fewer activities will be sorted
+    // directly into bottom rather than spawning a new rung
+    static constexpr size_t thresh_     = 50;
+    // Maximum number of rungs to create.  Once this is reached,
+    // buckets are sorted directly into bottom regardless of size
+    static constexpr size_t max_rungs_  = 8;
+    // Maximum number of buckets in a single rung
+    static constexpr size_t max_bucket_ = 1 << 16;
+
+    struct Rung
+    {
+        // Time of the start of the first bucket
+        SimTime_t                           start;
+        // Time of the end of the last bucket (inclusive).  The last
+        // bucket may be narrower than width.
+        SimTime_t                           end;
+        // Width of each bucket in core time units
+        SimTime_t                           width;
+        // Index of the next bucket to be dequeued.  All buckets below
+        // cur are covered by finer rungs or by bottom.
+        size_t                              cur;
+        // Number of activities across all buckets
+        size_t                              count;
+        std::vector<std::vector<Activity*>> buckets;
+
+        /** Lowest time that will be placed in this rung */
+        inline SimTime_t curStart() const { return start + cur * width; }
+        /** Returns true if there are buckets left to dequeue */
+        inline bool      active() const { return cur < buckets.size(); }
+    };
+
+    // Insert activity into the correct tier, no locking
+    void insert_int(Activity* activity);
+    // Move the next set of activities into bottom.  Returns false if
+    // the queue is empty.
+    bool refill();
+    // Sort a set of activities into bottom (bottom must be empty)
+    void fillBottom(std::vector<Activity*>& acts);
+    // Create a new rung covering [start, end] and distribute acts
+    // into it
+    void spawnRung(SimTime_t start, SimTime_t end, std::vector<Activity*>& acts);
+
+    // Top tier
+    std::vector<Activity*> top;
+    SimTime_t              top_boundary;
+
+    // Rungs.  Only the first num_rungs entries are in use; entries
+    // past that are kept so their bucket storage can be reused.
+    std::vector<Rung> rungs;
+    size_t            num_rungs;
+
+    // Bottom tier, sorted with latest activity first so we can pop
+    // from the back
+    std::vector<Activity*> bottom;
+
+    uint64_t insertOrder;
+
+    // Stats about usage
+    uint64_t max_depth;
+
+    // Need current depth to be atomic if we are thread safe
+    std::conditional_t<TS, std::atomic<uint64_t>, uint64_t> current_depth;
+
+    CACHE_ALIGNED(SST::Core::ThreadSafe::Spinlock, slock);
+};
+
+} // namespace IMPL
+} // namespace SST
+
+#endif // SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXLADDER_H
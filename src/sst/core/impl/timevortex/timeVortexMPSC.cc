@@ -0,0 +1,271 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/timevortex/timeVortexMPSC.h"
+
+#include "sst/core/config.h"
+#include "sst/core/output.h"
+#include "sst/core/simulation_impl.h"
+
+namespace SST::IMPL {
+
+namespace {
+// Thread number of the calling thread, looked up on the first insert
+// from a thread that doesn't own the TimeVortex
+thread_local int producer_thread = -1;
+
+inline int
+getProducerThread()
+{
+    if ( producer_thread < 0 ) {
+        producer_thread = Simulation_impl::getSimulation()->getRank().thread;
+    }
+    return producer_thread;
+}
+} // namespace
+
+template <bool TS>
+TimeVortexMPSCBase<TS>::Block::Block() :
+    next(nullptr)
+{
+    for ( auto& item : items ) {
+        item.store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+template <bool TS>
+TimeVortexMPSCBase<TS>::Stage::Stage() :
+    tail(new Block()),
+    tail_index(0),
+    head(tail),
+    head_index(0)
+{}
+
+template <bool TS>
+TimeVortexMPSCBase<TS>::Stage::~Stage()
+{
+    // Activities still in the block list are deleted by the
+    // TimeVortex, so just free the blocks
+    while ( head != nullptr ) {
+        Block* next = head->next.load(std::memory_order_relaxed);
+        delete head;
+        head = next;
+    }
+}
+
+template <bool TS>
+void
+TimeVortexMPSCBase<TS>::Stage::push(Activity* activity)
+{
+    if ( tail_index == Block::size_ ) {
+        // Link the new block before publishing anything in it.  The
+        // consumer only follows next after it has consumed the last
+        // slot of the current block.
+        Block* block = new Block();
+        tail->next.store(block, std::memory_order_release);
+        tail       = block;
+        tail_index = 0;
+    }
+    tail->items[tail_index++].store(activity, std::memory_order_release);
+}
+
+template <bool TS>
+TimeVortexMPSCBase<TS>::TimeVortexMPSCBase(Params& UNUSED(params)) :
+    TimeVortex(),
+    insertOrder(0),
+    max_depth(0),
+    current_depth(0),
+    owner(std::this_thread::get_id()),
+    num_stages(TS ? Simulation_impl::config.num_threads() : 0),
+    stages(num_stages > 0 ? new Stage[num_stages] : nullptr)
+{}
+
+template <bool TS>
+TimeVortexMPSCBase<TS>::~TimeVortexMPSCBase()
+{
+    // Activities in TimeVortexMPSC all need to be deleted
+    std::vector<Activity*> contents;
+    getContents(contents);
+    for ( auto* act : contents ) {
+        delete act;
+    }
+}
+
+template <bool TS>
+void
+TimeVortexMPSCBase<TS>::drain()
+{
+    for ( uint32_t i = 0; i < num_stages; ++i ) {
+        Stage& stage = stages[i];
+        while ( true ) {
+            if ( stage.head_index == Block::size_ ) {
+                Block* next = stage.head->next.load(std::memory_order_acquire);
+                if ( next == nullptr ) break;
+                delete stage.head;
+                stage.head       = next;
+                stage.head_index = 0;
+            }
+            Activity* act = stage.head->items[stage.head_index].load(std::memory_order_acquire);
+            if ( act == nullptr ) break;
+            stage.head_index++;
+            insert_local(act);
+        }
+    }
+}
+
+template <bool TS>
+bool
+TimeVortexMPSCBase<TS>::empty()
+{
+    if ( TS ) drain();
+    return data.empty();
+}
+
+template <bool TS>
+int
+TimeVortexMPSCBase<TS>::size()
+{
+    if ( TS ) drain();
+    return data.size();
+}
+
+template <bool TS>
+void
+TimeVortexMPSCBase<TS>::insert(Activity* activity)
+{
+    if ( !TS || std::this_thread::get_id() == owner ) {
+        insert_local(activity);
+        return;
+    }
+    stages[getProducerThread()].push(activity);
+}
+
+template <bool TS>
+Activity*
+TimeVortexMPSCBase<TS>::pop()
+{
+    if ( TS ) drain();
+    if ( data.empty() ) return nullptr;
+    Activity* ret_val = data.top();
+    data.pop();
+    current_depth--;
+    return ret_val;
+}
+
+template <bool TS>
+Activity*
+TimeVortexMPSCBase<TS>::front()
+{
+    if ( TS ) drain();
+    return data.empty() ? nullptr : data.top();
+}
+
+template <bool TS>
+void
+TimeVortexMPSCBase<TS>::popBatch(std::vector<Activity*>& batch)
+{
+    if ( TS ) drain();
+    if ( data.empty() ) return;
+    size_t    start = batch.size();
+    Activity* first = data.top();
+    data.pop();
+    batch.push_back(first);
+    if ( first->isEvent() ) {
+        while ( !data.empty() && sameBatch(first, data.top()) ) {
+            batch.push_back(data.top());
+            data.pop();
+        }
+    }
+    current_depth -= batch.size() - start;
+}
+
+template <bool TS>
+void
+TimeVortexMPSCBase<TS>::dbg_print(Output& out) const
+{
+    out.output("TimeVortex state:\n");
+
+    std::vector<Activity*> contents;
+    getContents(contents);
+    for ( auto* act : contents ) {
+        act->print("  ", out);
+    }
+}
+
+template <bool TS>
+void
+TimeVortexMPSCBase<TS>::getContents(std::vector<Activity*>& activities) const
+{
+    activities = getContainer();
+
+    // Also include anything that hasn't been merged yet
+    for ( uint32_t i = 0; i < num_stages; ++i ) {
+        const Stage& stage = stages[i];
+        const Block* block = stage.head;
+        size_t       index = stage.head_index;
+        while ( block != nullptr ) {
+            for ( ; index < Block::size_; ++index ) {
+                Activity* act = block->items[index].load(std::memory_order_acquire);
+                if ( act == nullptr ) break;
+                activities.push_back(act);
+            }
+            if ( index < Block::size_ ) break;
+            block = block->next.load(std::memory_order_acquire);
+            index = 0;
+        }
+    }
+}
+
+class TimeVortexMPSC : public TimeVortexMPSCBase<false>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexMPSC,
+        "sst",
+        "timevortex.mpsc",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "TimeVortex based on std::priority_queue that stages inserts from other threads in lock-free buffers.")
+
+    explicit TimeVortexMPSC(Params& params) :
+        TimeVortexMPSCBase<false>(params)
+    {}
+    TimeVortexMPSC() = delete;
+    ~TimeVortexMPSC() {}
+
+    SST_ELI_EXPORT(TimeVortexMPSC)
+};
+
+class TimeVortexMPSC_ts : public TimeVortexMPSCBase<true>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexMPSC_ts,
+        "sst",
+        "timevortex.mpsc.ts",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Thread-safe verion of TimeVortex that stages inserts from other threads in lock-free per-thread buffers."
+        "  Do not reference this element directly; just specify sst.timevortex.mpsc and this version will be"
+        " selected for multithreaded runs with --interthread-links.")
+
+    explicit TimeVortexMPSC_ts(Params& params) :
+        TimeVortexMPSCBase<true>(params)
+    {}
+    TimeVortexMPSC_ts() = delete;
+    ~TimeVortexMPSC_ts() {}
+
+    SST_ELI_EXPORT(TimeVortexMPSC_ts)
+};
+
+} // namespace SST::IMPL
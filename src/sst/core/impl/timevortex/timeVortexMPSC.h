@@ -0,0 +1,151 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXMPSC_H
+#define SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXMPSC_H
+
+#include "sst/core/activity.h"
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/timeVortex.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace SST {
+
+class Output;
+
+namespace IMPL {
+
+/**
+ * Primary Event Queue with lock-free staging for inserts from other
+ * threads.
+ *
+ * The queue itself is a std::priority_queue that is only ever touched
+ * by the thread that owns the TimeVortex.  When the TimeVortex is
+ * thread safe (TS = true), inserts from other threads (i.e. events
+ * sent on direct interthread links, which skip the thread sync's
+ * channels for this TimeVortex) are appended to a staging buffer
+ * dedicated to the sending thread.  Each staging buffer is a
+ * single-producer/single-consumer list of fixed size blocks, so
+ * producers never contend with each other or take a lock.  The owning
+ * thread merges all the staging buffers into the priority queue
+ * before looking at the queue in pop(), front(), etc.
+ *
+ * Activities that are staged get their queue order when they are
+ * merged, so activities from a single producer stay in the order
+ * they were inserted.
+ */
+template <bool TS>
+class TimeVortexMPSCBase : public TimeVortex
+{
+
+public:
+    explicit TimeVortexMPSCBase(Params& params);
+    TimeVortexMPSCBase() = delete;
+    ~TimeVortexMPSCBase();
+
+    bool      empty() override;
+    int       size() override;
+    void      insert(Activity* activity) override;
+    Activity* pop() override;
+    Activity* front() override;
+    void      popBatch(std::vector<Activity*>& batch) override;
+
+    uint64_t getCurrentDepth() const override { return current_depth; }
+    uint64_t getMaxDepth() const override { return max_depth; }
+
+    void dbg_print(Output& out) const override;
+
+    void getContents(std::vector<Activity*>& activities) const override;
+
+private:
+    using dataType_t = std::priority_queue<Activity*, std::vector<Activity*>, Activity::greater<true, true, true>>;
+
+    // Get a const reference to the underlying data
+    const std::vector<Activity*>& getContainer() const
+    {
+        struct UnderlyingContainer : dataType_t
+        {
+            using dataType_t::c; // access protected container
+        };
+        return static_cast<const UnderlyingContainer&>(data).c;
+    }
+
+    // Block of staged activities.  Empty slots are nullptr.
+    struct Block
+    {
+        static constexpr size_t size_ = 256;
+
+        std::atomic<Activity*> items[size_];
+        std::atomic<Block*>    next;
+
+        Block();
+    };
+
+    // Staging buffer for a single producer thread.  The producer and
+    // consumer sides are kept on separate cache lines.
+    struct Stage
+    {
+        // Only touched by the producer
+        alignas(64) Block* tail;
+        size_t tail_index;
+
+        // Only touched by the owning (consumer) thread
+        alignas(64) Block* head;
+        size_t head_index;
+
+        Stage();
+        ~Stage();
+        Stage(const Stage&)            = delete;
+        Stage& operator=(const Stage&) = delete;
+
+        void push(Activity* activity);
+    };
+
+    // Insert into the priority queue, owning thread only
+    inline void insert_local(Activity* activity)
+    {
+        assignQueueOrder(activity, insertOrder);
+        data.push(activity);
+        current_depth++;
+        if ( current_depth > max_depth ) {
+            max_depth = current_depth;
+        }
+    }
+
+    // Merge all the staged activities into the priority queue
+    void drain();
+
+    // Data
+    dataType_t data;
+    uint64_t   insertOrder;
+
+    // Stats about usage
+    uint64_t max_depth;
+    uint64_t current_depth;
+
+    // Thread that owns this TimeVortex and one staging buffer per
+    // thread (only used if TS is true)
+    std::thread::id          owner;
+    uint32_t                 num_stages;
+    std::unique_ptr<Stage[]> stages;
+};
+
+} // namespace IMPL
+} // namespace SST
+
+#endif // SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXMPSC_H
@@ -16,6 +16,8 @@
 #include "sst/core/clock.h"
 #include "sst/core/output.h"
 
+#include <algorithm>
+
 namespace SST::IMPL {
 
 template <bool TS>
@@ -62,7 +64,7 @@ void
 TimeVortexPQBase<TS>::insert(Activity* activity)
 {
     if ( TS ) slock.lock();
-    activity->setQueueOrder(insertOrder++);
+    assignQueueOrder(activity, insertOrder);
     data.push(activity);
     current_depth++;
     if ( current_depth > max_depth ) {
@@ -71,6 +73,37 @@ TimeVortexPQBase<TS>::insert(Activity* activity)
     if ( TS ) slock.unlock();
 }
 
+template <bool TS>
+void
+TimeVortexPQBase<TS>::insertBatch(Activity** begin, size_t n)
+{
+    if ( TS ) slock.lock();
+    std::vector<Activity*>& heap     = getContainer();
+    size_t                  old_size = heap.size();
+    heap.reserve(old_size + n);
+    for ( size_t i = 0; i < n; ++i ) {
+        assignQueueOrder(begin[i], insertOrder);
+        heap.push_back(begin[i]);
+    }
+
+    // If the batch is at least as big as the existing heap, it is
+    // cheaper to rebuild the heap than to push each activity
+    if ( n > old_size ) {
+        std::make_heap(heap.begin(), heap.end(), Activity::greater<true, true, true>());
+    }
+    else {
+        for ( size_t i = old_size + 1; i <= heap.size(); ++i ) {
+            std::push_heap(heap.begin(), heap.begin() + i, Activity::greater<true, true, true>());
+        }
+    }
+
+    current_depth += n;
+    if ( current_depth > max_depth ) {
+        max_depth = current_depth;
+    }
+    if ( TS ) slock.unlock();
+}
+
 template <bool TS>
 Activity*
 TimeVortexPQBase<TS>::pop()
@@ -94,6 +127,29 @@ TimeVortexPQBase<TS>::front()
     return ret;
 }
 
+template <bool TS>
+void
+TimeVortexPQBase<TS>::popBatch(std::vector<Activity*>& batch)
+{
+    if ( TS ) slock.lock();
+    if ( data.empty() ) {
+        if ( TS ) slock.unlock();
+        return;
+    }
+    size_t    start = batch.size();
+    Activity* first = data.top();
+    data.pop();
+    batch.push_back(first);
+    if ( first->isEvent() ) {
+        while ( !data.empty() && sameBatch(first, data.top()) ) {
+            batch.push_back(data.top());
+            data.pop();
+        }
+    }
+    current_depth -= batch.size() - start;
+    if ( TS ) slock.unlock();
+}
+
 template <bool TS>
 void
 TimeVortexPQBase<TS>::dbg_print(Output& out) const
@@ -144,9 +200,9 @@ public:
         "sst",
         "timevortex.priority_queue.ts",
         SST_ELI_ELEMENT_VERSION(1, 0, 0),
-        "Thread-safe verion of TimeVortex based on std::priority_queue.  Do not reference this element directly; just"
-        " specify sst.timevortex.priority_queue and this version will be selected when it is needed based on other"
-        " parameters.")
+        "Thread-safe verion of TimeVortex based on std::priority_queue."
+        "  Only needed if specified with --interthread-links, in which case events from other threads are inserted"
+        " directly instead of going through the thread sync.")
 
     explicit TimeVortexPQ_ts(Params& params) :
         TimeVortexPQBase<true>(params)
@@ -46,8 +46,10 @@ public:
     bool      empty() override;
     int       size() override;
     void      insert(Activity* activity) override;
+    void      insertBatch(Activity** begin, size_t n) override;
     Activity* pop() override;
     Activity* front() override;
+    void      popBatch(std::vector<Activity*>& batch) override;
 
     uint64_t getCurrentDepth() const override { return current_depth; }
     uint64_t getMaxDepth() const override { return max_depth; }
@@ -69,6 +71,17 @@ private:
         return static_cast<const UnderlyingContainer&>(data).c;
     }
 
+    // Get a reference to the underlying data.  The container must be
+    // a valid heap when the lock is released.
+    std::vector<Activity*>& getContainer()
+    {
+        struct UnderlyingContainer : dataType_t
+        {
+            using dataType_t::c; // access protected container
+        };
+        return static_cast<UnderlyingContainer&>(data).c;
+    }
+
     // Data
     dataType_t data;
     uint64_t   insertOrder;
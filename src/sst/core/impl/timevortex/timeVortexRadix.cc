@@ -0,0 +1,279 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/timevortex/timeVortexRadix.h"
+
+#include "sst/core/output.h"
+
+#include <algorithm>
+
+namespace SST::IMPL {
+
+template <bool TS>
+TimeVortexRadixBase<TS>::TimeVortexRadixBase(Params& UNUSED(params)) :
+    TimeVortex(),
+    last_time(0),
+    occupied(0),
+    insertOrder(0),
+    max_depth(0),
+    current_depth(0)
+{}
+
+template <bool TS>
+TimeVortexRadixBase<TS>::~TimeVortexRadixBase()
+{
+    // Activities in TimeVortexRadix all need to be deleted
+    std::vector<Activity*> contents;
+    getContents(contents);
+    for ( auto* act : contents ) {
+        delete act;
+    }
+}
+
+template <bool TS>
+bool
+TimeVortexRadixBase<TS>::empty()
+{
+    if ( TS ) slock.lock();
+    auto ret = current_depth == 0;
+    if ( TS ) slock.unlock();
+    return ret;
+}
+
+template <bool TS>
+int
+TimeVortexRadixBase<TS>::size()
+{
+    return current_depth;
+}
+
+template <bool TS>
+void
+TimeVortexRadixBase<TS>::insert(Activity* activity)
+{
+    if ( TS ) slock.lock();
+    assignQueueOrder(activity, insertOrder);
+    insert_int(activity);
+    current_depth++;
+    if ( current_depth > max_depth ) {
+        max_depth = current_depth;
+    }
+    if ( TS ) slock.unlock();
+}
+
+template <bool TS>
+void
+TimeVortexRadixBase<TS>::insertBatch(Activity** begin, size_t n)
+{
+    if ( TS ) slock.lock();
+    for ( size_t i = 0; i < n; ++i ) {
+        assignQueueOrder(begin[i], insertOrder);
+        insert_int(begin[i]);
+    }
+    current_depth += n;
+    if ( current_depth > max_depth ) {
+        max_depth = current_depth;
+    }
+    if ( TS ) slock.unlock();
+}
+
+template <bool TS>
+Activity*
+TimeVortexRadixBase<TS>::pop()
+{
+    if ( TS ) slock.lock();
+    if ( buckets[0].empty() && !refill() ) {
+        if ( TS ) slock.unlock();
+        return nullptr;
+    }
+    Activity* ret_val = buckets[0].back();
+    buckets[0].pop_back();
+    current_depth--;
+    if ( TS ) slock.unlock();
+    return ret_val;
+}
+
+template <bool TS>
+Activity*
+TimeVortexRadixBase<TS>::front()
+{
+    if ( TS ) slock.lock();
+    Activity* ret_val = nullptr;
+    if ( !buckets[0].empty() || refill() ) {
+        ret_val = buckets[0].back();
+    }
+    if ( TS ) slock.unlock();
+    return ret_val;
+}
+
+template <bool TS>
+void
+TimeVortexRadixBase<TS>::popBatch(std::vector<Activity*>& batch)
+{
+    if ( TS ) slock.lock();
+    if ( buckets[0].empty() && !refill() ) {
+        if ( TS ) slock.unlock();
+        return;
+    }
+    // Bucket 0 holds every activity with the current time, so no
+    // refill is needed inside the loop
+    auto&     bin   = buckets[0];
+    size_t    start = batch.size();
+    Activity* first = bin.back();
+    bin.pop_back();
+    batch.push_back(first);
+    if ( first->isEvent() ) {
+        while ( !bin.empty() && sameBatch(first, bin.back()) ) {
+            batch.push_back(bin.back());
+            bin.pop_back();
+        }
+    }
+    current_depth -= batch.size() - start;
+    if ( TS ) slock.unlock();
+}
+
+template <bool TS>
+void
+TimeVortexRadixBase<TS>::getContents(std::vector<Activity*>& activities) const
+{
+    activities.clear();
+    for ( auto& bucket : buckets ) {
+        activities.insert(activities.end(), bucket.begin(), bucket.end());
+    }
+    activities.insert(activities.end(), overflow.begin(), overflow.end());
+}
+
+template <bool TS>
+void
+TimeVortexRadixBase<TS>::insert_int(Activity* activity)
+{
+    int index = bucketIndex(activity->getDeliveryTime());
+    if ( index == 0 ) {
+        // Goes into the current bin.  Bin is sorted with the latest
+        // activity first, so upper_bound gives us the position of the
+        // first activity that will be delivered before this one.
+        auto& bin = buckets[0];
+        auto  it  = std::upper_bound(bin.begin(), bin.end(), activity, Activity::greater<true, true, true>());
+        bin.insert(it, activity);
+    }
+    else {
+        distribute(activity);
+    }
+}
+
+template <bool TS>
+void
+TimeVortexRadixBase<TS>::distribute(Activity* activity)
+{
+    int index = bucketIndex(activity->getDeliveryTime());
+    if ( index < num_buckets_ ) {
+        buckets[index].push_back(activity);
+        occupied |= (uint64_t(1) << index);
+    }
+    else {
+        overflow.push_back(activity);
+        std::push_heap(overflow.begin(), overflow.end(), Activity::greater<true, false, false>());
+    }
+}
+
+template <bool TS>
+bool
+TimeVortexRadixBase<TS>::refill()
+{
+    // The occupied bit for bucket 0 is never used
+    occupied &= ~uint64_t(1);
+
+    while ( buckets[0].empty() ) {
+        if ( occupied == 0 ) {
+            if ( overflow.empty() ) return false;
+
+            // Buckets are empty, so move everything in the overflow
+            // heap that is close enough to the earliest overflow time
+            // into the buckets
+            last_time = overflow.front()->getDeliveryTime();
+            while ( !overflow.empty() && bucketIndex(overflow.front()->getDeliveryTime()) < num_buckets_ ) {
+                std::pop_heap(overflow.begin(), overflow.end(), Activity::greater<true, false, false>());
+                Activity* act = overflow.back();
+                overflow.pop_back();
+                distribute(act);
+            }
+        }
+        else {
+            // Redistribute the lowest non-empty bucket around its
+            // earliest time.  Everything in the bucket will move to a
+            // lower bucket.
+            int   index  = __builtin_ctzll(occupied);
+            auto& bucket = buckets[index];
+            occupied &= ~(uint64_t(1) << index);
+
+            SimTime_t min_time = bucket.front()->getDeliveryTime();
+            for ( auto* act : bucket ) {
+                if ( act->getDeliveryTime() < min_time ) min_time = act->getDeliveryTime();
+            }
+            last_time = min_time;
+
+            for ( auto* act : bucket ) {
+                distribute(act);
+            }
+            bucket.clear();
+        }
+        occupied &= ~uint64_t(1);
+    }
+
+    std::sort(buckets[0].begin(), buckets[0].end(), Activity::greater<true, true, true>());
+    return true;
+}
+
+class TimeVortexRadix : public TimeVortexRadixBase<false>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexRadix,
+        "sst",
+        "timevortex.map.radix",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "TimeVortex with events binned by time using a radix heap, with a heap for far future events.")
+
+    explicit TimeVortexRadix(Params& params) :
+        TimeVortexRadixBase<false>(params)
+    {}
+    TimeVortexRadix() = delete;
+    ~TimeVortexRadix() {}
+
+    SST_ELI_EXPORT(TimeVortexRadix)
+};
+
+class TimeVortexRadix_ts : public TimeVortexRadixBase<true>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexRadix_ts,
+        "sst",
+        "timevortex.map.radix.ts",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Thread-safe verion of TimeVortex with events binned by time using a radix heap."
+        "  Only needed if specified with --interthread-links, in which case events from other threads are inserted"
+        " directly instead of going through the thread sync.")
+
+    explicit TimeVortexRadix_ts(Params& params) :
+        TimeVortexRadixBase<true>(params)
+    {}
+    TimeVortexRadix_ts() = delete;
+    ~TimeVortexRadix_ts() {}
+
+    SST_ELI_EXPORT(TimeVortexRadix_ts)
+};
+
+} // namespace SST::IMPL
@@ -0,0 +1,122 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXRADIX_H
+#define SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXRADIX_H
+
+#include "sst/core/activity.h"
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/threadsafe.h"
+#include "sst/core/timeVortex.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace SST {
+
+class Output;
+
+namespace IMPL {
+
+/**
+ * Primary Event Queue that bins activities by time using a radix
+ * heap instead of a std::map.
+ *
+ * Activities are placed into a bucket based on the highest bit in
+ * which their delivery time differs from the time of the last
+ * activity popped (last_time).  Bucket 0 is the bin for last_time
+ * itself and is kept fully sorted.  Bucket i holds activities whose
+ * times agree with last_time in every bit above bit i-1, so near
+ * future times land in low buckets and the bucket for any time is
+ * found in O(1).  When bucket 0 runs dry, the lowest non-empty bucket
+ * is redistributed around its earliest time; each activity can only
+ * move down, so this is amortized O(1) per bit of distance.
+ *
+ * Activities that differ from last_time above overflow_bit_ (very far
+ * future, e.g. the StopAction) are kept in a separate heap and only
+ * moved into the buckets once the buckets are empty.
+ *
+ * Delivery times must not be earlier than the last popped time, which
+ * always holds for the main event loop.
+ */
+template <bool TS>
+class TimeVortexRadixBase : public TimeVortex
+{
+
+public:
+    explicit TimeVortexRadixBase(Params& params);
+    TimeVortexRadixBase() = delete;
+    ~TimeVortexRadixBase();
+
+    bool      empty() override;
+    int       size() override;
+    void      insert(Activity* activity) override;
+    void      insertBatch(Activity** begin, size_t n) override;
+    Activity* pop() override;
+    Activity* front() override;
+    void      popBatch(std::vector<Activity*>& batch) override;
+
+    uint64_t getCurrentDepth() const override { return current_depth; }
+    uint64_t getMaxDepth() const override { return max_depth; }
+
+    void getContents(std::vector<Activity*>& activities) const override;
+
+private:
+    // Times that differ from last_time in this bit or higher go into
+    // the overflow heap
+    static constexpr int overflow_bit_ = 48;
+    static constexpr int num_buckets_  = overflow_bit_ + 1;
+
+    // Insert activity into the correct bucket, no locking
+    void insert_int(Activity* activity);
+    // Insert activity into the correct bucket without keeping bucket
+    // 0 sorted.  Used while refilling.
+    void distribute(Activity* activity);
+    // Make sure bucket 0 holds the next activities.  Returns false
+    // if the queue is empty.
+    bool refill();
+
+    /** Returns the bucket index for time, or num_buckets_ for overflow */
+    inline int bucketIndex(SimTime_t time) const
+    {
+        if ( time <= last_time ) return 0;
+        return 64 - __builtin_clzll(time ^ last_time);
+    }
+
+    // Time of the current bin (bucket 0)
+    SimTime_t last_time;
+
+    // Bucket 0 is sorted with latest activity first so we can pop
+    // from the back.  All other buckets are unsorted.
+    std::vector<Activity*> buckets[num_buckets_];
+    // Bit i is set if buckets[i] is not empty (i > 0)
+    uint64_t               occupied;
+
+    // Far future activities, kept as a min-heap on delivery time
+    std::vector<Activity*> overflow;
+
+    uint64_t insertOrder;
+
+    // Stats about usage
+    uint64_t max_depth;
+
+    // Need current depth to be atomic if we are thread safe
+    std::conditional_t<TS, std::atomic<uint64_t>, uint64_t> current_depth;
+
+    CACHE_ALIGNED(SST::Core::ThreadSafe::Spinlock, slock);
+};
+
+} // namespace IMPL
+} // namespace SST
+
+#endif // SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXRADIX_H
@@ -14,4 +14,94 @@
 
 #include "sst/core/interfaces/stdMem.h"
 
+#include "sst/core/output.h"
+
+#include <cinttypes>
+#include <cstdint>
+#include <cstring>
+#include <new>
+
 std::atomic<SST::Interfaces::StandardMem::Request::id_t> SST::Interfaces::StandardMem::Request::main_id(0);
+
+namespace SST::Interfaces {
+
+StandardMem::Payload::Buffer*
+StandardMem::Payload::Buffer::create(size_t size)
+{
+    // The size is stored (and serialized) as 32 bits
+    if ( size > UINT32_MAX ) {
+        Output::getDefaultObject().fatal(CALL_INFO, 1,
+            "StandardMem payloads are limited to %" PRIu32 " bytes, but %zu were requested\n", UINT32_MAX, size);
+    }
+
+    // Round the data size up to a power of two so the number of
+    // distinct pool sizes stays small
+    size_t capacity = 8;
+    while ( capacity < size ) {
+        capacity <<= 1;
+    }
+
+    bool  pooled = capacity <= max_pooled_size;
+    void* mem    = pooled ? SST::Core::MemPoolItem::operator new(sizeof(Buffer) + capacity)
+                          : ::operator new(sizeof(Buffer) + size);
+    return ::new (mem) Buffer(static_cast<uint32_t>(size), pooled);
+}
+
+void
+StandardMem::Payload::Buffer::destroy(Buffer* buffer)
+{
+    if ( buffer->pooled ) {
+        // MemPoolItem::operator delete gets the pool from the size
+        // stored in the allocation header
+        delete buffer;
+    }
+    else {
+        buffer->~Buffer();
+        ::operator delete(buffer);
+    }
+}
+
+StandardMem::Payload::Payload(size_t size, uint8_t fill)
+{
+    if ( size == 0 ) return;
+    buffer = Buffer::create(size);
+    std::memset(buffer->bytes(), fill, size);
+}
+
+StandardMem::Payload::Payload(const uint8_t* data, size_t size)
+{
+    if ( size == 0 ) return;
+    buffer = Buffer::create(size);
+    std::memcpy(buffer->bytes(), data, size);
+}
+
+void
+StandardMem::Payload::serialize_order(SST::Core::Serialization::serializer& ser)
+{
+    switch ( ser.mode() ) {
+    case SST::Core::Serialization::serializer::SIZER:
+    case SST::Core::Serialization::serializer::PACK:
+    {
+        uint32_t len = size();
+        SST_SER(len);
+        if ( len != 0 ) ser.raw(const_cast<uint8_t*>(data()), len);
+        break;
+    }
+    case SST::Core::Serialization::serializer::UNPACK:
+    {
+        uint32_t len;
+        SST_SER(len);
+        release();
+        if ( len != 0 ) {
+            buffer = Buffer::create(len);
+            ser.raw(buffer->bytes(), len);
+        }
+        break;
+    }
+    case SST::Core::Serialization::serializer::MAP:
+        // Payloads are not mapped
+        break;
+    }
+}
+
+} // namespace SST::Interfaces
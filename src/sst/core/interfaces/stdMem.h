@@ -28,6 +28,7 @@
 #include <ios>
 #include <map>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -133,6 +134,144 @@ public:
     using Addr = uint64_t;
 #define PRI_ADDR PRIx64
 
+    /**
+     * Immutable, reference counted block of data for requests that
+     * carry data (ReadResp, Write and WriteUnlock).
+     *
+     * Copying a Payload only adds a reference, so the same data can
+     * be shared by a request and its response, or forwarded through
+     * several levels of a memory hierarchy, without copying the bytes.
+     * The data is freed when the last Payload referencing it is
+     * destroyed.  Buffers up to max_pooled_size bytes come from the
+     * core memory pools.  The reference count is atomic, so Payloads
+     * can be passed between threads.
+     *
+     * Payloads serialize as the size followed by the raw bytes.
+     */
+    class Payload
+    {
+    public:
+        /** Largest buffer, in bytes, that is allocated from the memory pools */
+        static constexpr size_t max_pooled_size = 4096;
+
+        /** Create an empty Payload */
+        Payload() = default;
+
+        /** Create a Payload holding size bytes, all set to fill */
+        explicit Payload(size_t size, uint8_t fill = 0);
+
+        /** Create a Payload holding a copy of size bytes starting at data */
+        Payload(const uint8_t* data, size_t size);
+
+        /** Create a Payload holding a copy of data */
+        explicit Payload(const std::vector<uint8_t>& data) :
+            Payload(data.data(), data.size())
+        {}
+
+        Payload(const Payload& other) :
+            buffer(other.buffer)
+        {
+            if ( buffer ) buffer->refs.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        Payload(Payload&& other) noexcept :
+            buffer(other.buffer)
+        {
+            other.buffer = nullptr;
+        }
+
+        Payload& operator=(const Payload& other)
+        {
+            if ( other.buffer ) other.buffer->refs.fetch_add(1, std::memory_order_relaxed);
+            release();
+            buffer = other.buffer;
+            return *this;
+        }
+
+        Payload& operator=(Payload&& other) noexcept
+        {
+            if ( this != &other ) {
+                release();
+                buffer       = other.buffer;
+                other.buffer = nullptr;
+            }
+            return *this;
+        }
+
+        ~Payload() { release(); }
+
+        /** Returns a pointer to the data, or nullptr if the Payload is empty */
+        const uint8_t* data() const { return buffer ? buffer->bytes() : nullptr; }
+
+        /** Returns the number of bytes in the Payload */
+        size_t size() const { return buffer ? buffer->size : 0; }
+
+        bool empty() const { return size() == 0; }
+
+        const uint8_t& operator[](size_t index) const { return buffer->bytes()[index]; }
+
+        const uint8_t* begin() const { return data(); }
+        const uint8_t* end() const { return data() + size(); }
+
+        /** Returns a copy of the data as a vector */
+        std::vector<uint8_t> toVector() const { return std::vector<uint8_t>(begin(), end()); }
+
+        /** Returns the number of Payloads referencing the same data */
+        uint32_t useCount() const { return buffer ? buffer->refs.load(std::memory_order_relaxed) : 0; }
+
+        /** Returns true if both Payloads reference the same data */
+        bool sharesDataWith(const Payload& other) const { return buffer != nullptr && buffer == other.buffer; }
+
+        void serialize_order(SST::Core::Serialization::serializer& ser);
+
+    private:
+        /*
+         * Reference count, size and data in one allocation.  The data
+         * follows the Buffer object.  Inherits from MemPoolItem so the
+         * buffers can come from the memory pools.
+         */
+        class Buffer : public SST::Core::MemPoolItem
+        {
+        public:
+            std::atomic<uint32_t> refs;
+            uint32_t              size;
+            bool                  pooled;
+
+            Buffer(uint32_t size, bool pooled) :
+                refs(1),
+                size(size),
+                pooled(pooled)
+            {}
+
+            uint8_t* bytes() { return reinterpret_cast<uint8_t*>(this + 1); }
+
+            const uint8_t* bytes() const { return reinterpret_cast<const uint8_t*>(this + 1); }
+
+            /** Allocate a buffer with room for size bytes of data */
+            static Buffer* create(size_t size);
+
+            /** Free a buffer whose reference count has reached 0 */
+            static void destroy(Buffer* buffer);
+
+            NotSerializable(SST::Interfaces::StandardMem::Payload::Buffer)
+        };
+
+        void release()
+        {
+            if ( buffer && buffer->refs.fetch_sub(1, std::memory_order_acq_rel) == 1 ) Buffer::destroy(buffer);
+            buffer = nullptr;
+        }
+
+        Buffer* buffer = nullptr;
+    };
+
+    /*
+     * Used to constrain the Payload constructors of the requests so
+     * that arguments like {} still select the std::vector versions
+     */
+    template <typename T>
+    using EnablePayload = std::enable_if_t<std::is_same_v<std::decay_t<T>, Payload>, int>;
+
     /**
      * Base class for StandardMem commands
      */
@@ -376,6 +515,31 @@ public:
             tid(readEv->tid)
         {}
 
+        /** Create a response that shares respData instead of copying it */
+        template <typename PayloadT, EnablePayload<PayloadT> = 0>
+        ReadResp(id_t rid, Addr physAddr, uint64_t size, PayloadT&& respData, flags_t flags = 0, Addr virtAddr = 0,
+            Addr instPtr = 0, uint32_t tid = 0) :
+            Request(rid, flags),
+            pAddr(physAddr),
+            vAddr(virtAddr),
+            size(size),
+            payload(std::forward<PayloadT>(respData)),
+            iPtr(instPtr),
+            tid(tid)
+        {}
+
+        /** Create a response that shares respData instead of copying it */
+        template <typename PayloadT, EnablePayload<PayloadT> = 0>
+        ReadResp(Read* readEv, PayloadT&& respData) :
+            Request(readEv->getID(), readEv->getAllFlags()),
+            pAddr(readEv->pAddr),
+            vAddr(readEv->vAddr),
+            size(readEv->size),
+            payload(std::forward<PayloadT>(respData)),
+            iPtr(readEv->iPtr),
+            tid(readEv->tid)
+        {}
+
         virtual ~ReadResp() {}
 
         Request* makeResponse() override { return nullptr; } /* No response type */
@@ -394,8 +558,9 @@ public:
             str << ", VirtAddr: 0x" << vAddr << ", Size: " << std::dec << size << ", InstPtr: 0x" << std::hex << iPtr;
             str << ", ThreadID: " << std::dec << tid << ", Payload: 0x" << std::hex;
             str << std::setfill('0');
-            for ( std::vector<uint8_t>::iterator it = data.begin(); it != data.end(); it++ ) {
-                str << std::setw(2) << static_cast<unsigned>(*it);
+            const uint8_t* bytes = getDataPtr();
+            for ( size_t i = 0; i < getDataSize(); i++ ) {
+                str << std::setw(2) << static_cast<unsigned>(bytes[i]);
             }
             return str.str();
         }
@@ -404,9 +569,20 @@ public:
         Addr                 pAddr; /* Physical address */
         Addr                 vAddr; /* Virtual address */
         uint64_t             size;  /* Number of bytes to read */
-        std::vector<uint8_t> data;  /* Read data */
-        Addr                 iPtr;  /* Instruction pointer - optional metadata */
-        uint32_t             tid;   /* Thread ID */
+        std::vector<uint8_t> data;    /* Read data */
+        Payload              payload; /* Read data, if the response was created with a Payload */
+        Addr                 iPtr;    /* Instruction pointer - optional metadata */
+        uint32_t             tid;     /* Thread ID */
+
+        /** Returns a pointer to the data, whether it is held in data or payload */
+        const uint8_t* getDataPtr() const { return payload.empty() ? data.data() : payload.data(); }
+
+        /** Returns the number of bytes held in data or payload */
+        size_t getDataSize() const { return payload.empty() ? data.size() : payload.size(); }
+
+        /** Returns the data as a Payload.  Shares payload if it is set,
+         * otherwise copies data */
+        Payload getPayload() const { return payload.empty() ? Payload(data) : payload; }
 
         /* Serialization */
         ReadResp() :
@@ -419,11 +595,13 @@ public:
             SST_SER(pAddr);
             SST_SER(vAddr);
             SST_SER(size);
+            SST_SER(data);
+            SST_SER(payload);
             SST_SER(iPtr);
             SST_SER(tid);
         }
 
-        ImplementSerializable(SST::Interfaces::StandardMem::Read);
+        ImplementSerializable(SST::Interfaces::StandardMem::ReadResp);
     };
 
     /** Request to write data.
@@ -445,6 +623,21 @@ public:
             iPtr(instPtr),
             tid(tid)
         {}
+
+        /** Create a write that shares wData instead of copying it */
+        template <typename PayloadT, EnablePayload<PayloadT> = 0>
+        Write(Addr physAddr, uint64_t size, PayloadT&& wData, bool posted = false, flags_t flags = 0,
+            Addr virtAddr = 0, Addr instPtr = 0, uint32_t tid = 0) :
+            Request(flags),
+            pAddr(physAddr),
+            vAddr(virtAddr),
+            size(size),
+            payload(std::forward<PayloadT>(wData)),
+            posted(posted),
+            iPtr(instPtr),
+            tid(tid)
+        {}
+
         /* Destructor */
         virtual ~Write() {}
 
@@ -465,8 +658,9 @@ public:
             str << ", InstPtr: 0x" << std::hex << iPtr << ", ThreadID: " << std::dec << tid << ", Payload: 0x"
                 << std::hex;
             str << std::setfill('0');
-            for ( std::vector<uint8_t>::iterator it = data.begin(); it != data.end(); it++ ) {
-                str << std::setw(2) << static_cast<unsigned>(*it);
+            const uint8_t* bytes = getDataPtr();
+            for ( size_t i = 0; i < getDataSize(); i++ ) {
+                str << std::setw(2) << static_cast<unsigned>(bytes[i]);
             }
             return str.str();
         }
@@ -475,10 +669,21 @@ public:
         Addr                 pAddr;  /* Physical address */
         Addr                 vAddr;  /* Virtual address */
         uint64_t             size;   /* Number of bytes to write */
-        std::vector<uint8_t> data;   /* Written data */
-        bool                 posted; /* Whether write is posted (requires no response) */
-        Addr                 iPtr;   /* Instruction pointer - optional metadata */
-        uint32_t             tid;    /* Thread ID */
+        std::vector<uint8_t> data;    /* Written data */
+        Payload              payload; /* Written data, if the request was created with a Payload */
+        bool                 posted;  /* Whether write is posted (requires no response) */
+        Addr                 iPtr;    /* Instruction pointer - optional metadata */
+        uint32_t             tid;     /* Thread ID */
+
+        /** Returns a pointer to the data, whether it is held in data or payload */
+        const uint8_t* getDataPtr() const { return payload.empty() ? data.data() : payload.data(); }
+
+        /** Returns the number of bytes held in data or payload */
+        size_t getDataSize() const { return payload.empty() ? data.size() : payload.size(); }
+
+        /** Returns the data as a Payload.  Shares payload if it is set,
+         * otherwise copies data */
+        Payload getPayload() const { return payload.empty() ? Payload(data) : payload; }
 
         /* Serialization */
         Write() :
@@ -492,6 +697,7 @@ public:
             SST_SER(vAddr);
             SST_SER(size);
             SST_SER(data);
+            SST_SER(payload);
             SST_SER(posted);
             SST_SER(iPtr);
             SST_SER(tid);
@@ -851,6 +1057,20 @@ public:
             tid(tid)
         {}
 
+        /** Create a write that shares wData instead of copying it */
+        template <typename PayloadT, EnablePayload<PayloadT> = 0>
+        WriteUnlock(Addr physAddr, uint64_t size, PayloadT&& wData, bool posted = false, flags_t flags = 0,
+            Addr virtAddr = 0, Addr instPtr = 0, uint32_t tid = 0) :
+            Request(flags),
+            pAddr(physAddr),
+            vAddr(virtAddr),
+            size(size),
+            payload(std::forward<PayloadT>(wData)),
+            posted(posted),
+            iPtr(instPtr),
+            tid(tid)
+        {}
+
         virtual ~WriteUnlock() {}
 
         virtual Request* makeResponse() override { return new WriteResp(id, pAddr, size, flags, vAddr = 0, iPtr, tid); }
@@ -870,8 +1090,9 @@ public:
             str << ", InstPtr: 0x" << std::hex << iPtr << ", ThreadID: " << std::dec << tid << ", Payload: 0x"
                 << std::hex;
             str << std::setfill('0');
-            for ( std::vector<uint8_t>::iterator it = data.begin(); it != data.end(); it++ ) {
-                str << std::setw(2) << static_cast<unsigned>(*it);
+            const uint8_t* bytes = getDataPtr();
+            for ( size_t i = 0; i < getDataSize(); i++ ) {
+                str << std::setw(2) << static_cast<unsigned>(bytes[i]);
             }
             return str.str();
         }
@@ -880,10 +1101,21 @@ public:
         Addr                 pAddr;  /* Physical address */
         Addr                 vAddr;  /* Virtual address */
         uint64_t             size;   /* Number of bytes to write */
-        std::vector<uint8_t> data;   /* Written data */
-        bool                 posted; /* Whether write is posted (requires no response) */
-        Addr                 iPtr;   /* Instruction pointer - optional metadata */
-        uint32_t             tid;    /* Thread ID */
+        std::vector<uint8_t> data;    /* Written data */
+        Payload              payload; /* Written data, if the request was created with a Payload */
+        bool                 posted;  /* Whether write is posted (requires no response) */
+        Addr                 iPtr;    /* Instruction pointer - optional metadata */
+        uint32_t             tid;     /* Thread ID */
+
+        /** Returns a pointer to the data, whether it is held in data or payload */
+        const uint8_t* getDataPtr() const { return payload.empty() ? data.data() : payload.data(); }
+
+        /** Returns the number of bytes held in data or payload */
+        size_t getDataSize() const { return payload.empty() ? data.size() : payload.size(); }
+
+        /** Returns the data as a Payload.  Shares payload if it is set,
+         * otherwise copies data */
+        Payload getPayload() const { return payload.empty() ? Payload(data) : payload; }
 
         /* Serialization */
         WriteUnlock() :
@@ -897,6 +1129,7 @@ public:
             SST_SER(vAddr);
             SST_SER(size);
             SST_SER(data);
+            SST_SER(payload);
             SST_SER(posted);
             SST_SER(iPtr);
             SST_SER(tid);
@@ -101,6 +101,67 @@ public:
         }
     }
 
+    bool writeNB(const T& v)
+    {
+        if ( bufferMutex.try_lock() ) {
+            if ( ((writeIndex + 1) % buffSize) != readIndex ) {
+                buffer[writeIndex] = v;
+                writeIndex         = (writeIndex + 1) % buffSize;
+
+                __sync_synchronize();
+                bufferMutex.unlock();
+                return true;
+            }
+
+            bufferMutex.unlock();
+        }
+
+        return false;
+    }
+
+    /** Non-blocking read that hands the slot to func instead of
+     * copying it out.  func is called with a const reference to the
+     * slot while the buffer is locked. */
+    template <typename Func>
+    bool readInPlaceNB(Func&& func)
+    {
+        if ( bufferMutex.try_lock() ) {
+            if ( readIndex != writeIndex ) {
+                func(static_cast<const T&>(buffer[readIndex]));
+                readIndex = (readIndex + 1) % buffSize;
+
+                bufferMutex.unlock();
+                return true;
+            }
+
+            bufferMutex.unlock();
+        }
+
+        return false;
+    }
+
+    /** Non-blocking write that lets func fill in the slot instead of
+     * copying a value into it.  func is called with a reference to
+     * the slot while the buffer is locked. */
+    template <typename Func>
+    bool writeInPlaceNB(Func&& func)
+    {
+        if ( bufferMutex.try_lock() ) {
+            if ( ((writeIndex + 1) % buffSize) != readIndex ) {
+                func(buffer[writeIndex]);
+                writeIndex = (writeIndex + 1) % buffSize;
+
+                __sync_synchronize();
+                bufferMutex.unlock();
+                return true;
+            }
+
+            bufferMutex.unlock();
+        }
+
+        return false;
+    }
+
     ~CircularBuffer() {}
 
     void clearBuffer()
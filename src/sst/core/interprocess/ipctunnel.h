@@ -14,6 +14,7 @@
 
 #include "sst/core/interprocess/circularBuffer.h"
 
+#include <cinttypes>
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
@@ -23,6 +24,7 @@
 #include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
+#include <utility>
 #include <vector>
 
 namespace SST::Core::Interprocess {
@@ -180,7 +182,7 @@ public:
     /**
      * Shutdown
      */
-    void shutdown(bool all = false)
+    void shutdown([[maybe_unused]] bool all = false)
     {
         if ( master ) {
             for ( CircBuff_t* cb : circBuffs ) {
@@ -206,12 +208,29 @@ public:
     /** Blocks until space is available **/
     void writeMessage(size_t core, const MsgType& command) { circBuffs[core]->write(command); }
 
+    /** Non-blocking version of writeMessage **/
+    bool writeMessageNB(size_t core, const MsgType& command) { return circBuffs[core]->writeNB(command); }
+
     /** Blocks until a command is available **/
     MsgType readMessage(size_t buffer) { return circBuffs[buffer]->read(); }
 
     /** Non-blocking version of readMessage **/
     bool readMessageNB(size_t buffer, MsgType* result) { return circBuffs[buffer]->readNB(result); }
 
+    /** Non-blocking write that fills the message in place with func(MsgType&) **/
+    template <typename Func>
+    bool writeMessageInPlaceNB(size_t core, Func&& func)
+    {
+        return circBuffs[core]->writeInPlaceNB(std::forward<Func>(func));
+    }
+
+    /** Non-blocking read that passes the message in place to func(const MsgType&) **/
+    template <typename Func>
+    bool readMessageInPlaceNB(size_t buffer, Func&& func)
+    {
+        return circBuffs[buffer]->readInPlaceNB(std::forward<Func>(func));
+    }
+
     /** Empty the messages in the buffer **/
     void clearBuffer(size_t core) { circBuffs[core]->clearBuffer(); }
 
@@ -220,7 +239,7 @@ private:
     std::pair<size_t, T*> reserveSpace(size_t extraSpace = 0)
     {
         size_t space = sizeof(T) + extraSpace;
-        if ( ((nextAllocPtr + space) - (uint8_t*)shmPtr) > shmSize ) return std::make_pair<size_t, T*>(0, nullptr);
+        if ( (size_t)((nextAllocPtr + space) - (uint8_t*)shmPtr) > shmSize ) return std::make_pair<size_t, T*>(0, nullptr);
         T* ptr = (T*)nextAllocPtr;
         nextAllocPtr += space;
         new (ptr) T(); // Call constructor if need be
@@ -15,6 +15,7 @@
 
 #include "sst/core/event.h"
 #include "sst/core/factory.h"
+#include "sst/core/impl/linkStorage.h"
 #include "sst/core/initQueue.h"
 #include "sst/core/linkPair.h"
 #include "sst/core/pollingLinkQueue.h"
@@ -27,12 +28,45 @@
 #include "sst/core/timeLord.h"
 #include "sst/core/timeVortex.h"
 #include "sst/core/uninitializedQueue.h"
+#include "sst/core/threadsafe.h"
 #include "sst/core/unitAlgebra.h"
 
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
 #include <utility>
 
 namespace SST {
 
+struct Link::Extras
+{
+    ToolList tools;
+#ifdef __SST_DEBUG_EVENT_TRACKING__
+    std::string comp;
+    std::string ctype;
+    std::string port;
+#endif
+};
+
+// Side table holding the Link::Extras.  Entries are only added while
+// links are being configured or restored and only removed when a link
+// is deleted, so pointers into the map stay valid while it is in use.
+// The table is frozen while the simulation runs, so the lookups done
+// on every send don't need the lock.
+struct Link::ExtrasTable
+{
+    Core::ThreadSafe::Spinlock              lock;
+    std::unordered_map<const Link*, Extras> map;
+    std::atomic<bool>                       frozen { false };
+};
+
+Link::ExtrasTable&
+Link::getExtrasTable()
+{
+    static ExtrasTable table;
+    return table;
+}
+
 void
 SST::Core::Serialization::serialize_impl<Link*>::serialize_events(
     serializer& ser, uintptr_t delivery_info, ActivityQueue* queue)
@@ -217,8 +251,8 @@ SST::Core::Serialization::serialize_impl<Link*>::operator()(Link*& s, serializer
 
         // Determine how many serializable tools there are
         Link::ToolList tools;
-        if ( s->attached_tools ) {
-            for ( auto x : *s->attached_tools ) {
+        if ( Link::ToolList* attached = s->getAttachedTools() ) {
+            for ( auto x : *attached ) {
                 if ( dynamic_cast<SST::Core::Serialization::serializable*>(x.first) ) {
                     tools.push_back(x);
                 }
@@ -407,19 +441,16 @@ SST::Core::Serialization::serialize_impl<Link*>::operator()(Link*& s, serializer
         size_t tool_count;
         SST_SER(tool_count);
         if ( tool_count > 0 ) {
-            s->attached_tools = new Link::ToolList();
+            Link::ToolList& attached = s->getExtras().tools;
             for ( size_t i = 0; i < tool_count; ++i ) {
                 SST::Core::Serialization::serializable* tool;
                 uintptr_t                               key;
                 SST_SER(tool);
                 Link::AttachPoint* ap = dynamic_cast<Link::AttachPoint*>(tool);
                 ap->serializeEventAttachPointKey(ser, key);
-                s->attached_tools->emplace_back(ap, key);
+                attached.emplace_back(ap, key);
             }
         }
-        else {
-            s->attached_tools = nullptr;
-        }
 
         /*
           Deserialize the events targetting this link
@@ -475,7 +506,7 @@ public:
     }
 
 private:
-    ImplementSerializable(SST::NullEvent)
+    ImplementTriviallyRelocatableEvent(SST::NullEvent)
 };
 
 
@@ -488,8 +519,8 @@ Link::Link(LinkId_t tag) :
     current_time(Simulation_impl::getSimulation()->currentSimCycle),
     type(UNINITIALIZED),
     mode(INIT),
-    tag(tag),
-    attached_tools(nullptr)
+    has_extras(false),
+    tag(tag)
 {}
 
 Link::Link() :
@@ -501,8 +532,8 @@ Link::Link() :
     current_time(Simulation_impl::getSimulation()->currentSimCycle),
     type(UNINITIALIZED),
     mode(INIT),
-    tag(-1),
-    attached_tools(nullptr)
+    has_extras(false),
+    tag(-1)
 {}
 
 Link::~Link()
@@ -516,7 +547,23 @@ Link::~Link()
         if ( SYNC == pair_link->type ) delete pair_link;
     }
 
-    if ( attached_tools ) delete attached_tools;
+    if ( has_extras ) {
+        ExtrasTable&                                table = getExtrasTable();
+        std::lock_guard<Core::ThreadSafe::Spinlock> lock(table.lock);
+        table.map.erase(this);
+    }
+}
+
+void*
+Link::operator new(std::size_t size)
+{
+    return Core::LinkStorage::allocate(size);
+}
+
+void
+Link::operator delete(void* ptr, std::size_t size)
+{
+    Core::LinkStorage::deallocate(ptr, size);
 }
 
 void
@@ -681,20 +728,128 @@ Link::send_impl(SimTime_t delay, Event* event)
     event->setDeliveryInfo(tag, delivery_info);
 
 #if __SST_DEBUG_EVENT_TRACKING__
-    event->addSendComponent(comp, ctype, port);
-    event->addRecvComponent(pair_link->comp, pair_link->ctype, pair_link->port);
+    event->addSendComponent(getSendingComponentName(), getSendingComponentType(), getSendingPort());
+    event->addRecvComponent(pair_link->getSendingComponentName(), pair_link->getSendingComponentType(),
+        pair_link->getSendingPort());
 #endif
 
-    if ( attached_tools ) {
-        for ( auto& x : *attached_tools ) {
-            x.first->eventSent(x.second, event);
-            // Check to see if the event was deleted.  If so, return.
-            if ( nullptr == event ) return;
+    if ( has_extras ) {
+        if ( ToolList* tools = getAttachedTools() ) {
+            for ( auto& x : *tools ) {
+                x.first->eventSent(x.second, event);
+                // Check to see if the event was deleted.  If so, return.
+                if ( nullptr == event ) return;
+            }
         }
     }
     send_queue->insert(event);
 }
 
+void
+Link::sendBatch_impl(SimTime_t delay, Event* const* events, size_t n)
+{
+    if ( n == 0 ) return;
+    if ( n == 1 ) {
+        send_impl(delay, events[0]);
+        return;
+    }
+
+    if ( RUN != mode ) {
+        if ( INIT == mode ) {
+            Simulation_impl::getSimulation()->getSimulationOutput().fatal(CALL_INFO, 1,
+                "ERROR: Trying to send or recv from link during initialization.  Send and Recv cannot be called before "
+                "setup.\n");
+        }
+        else if ( COMPLETE == mode ) {
+            Simulation_impl::getSimulation()->getSimulationOutput().fatal(
+                CALL_INFO, 1, "ERROR: Trying to call send or recv during complete phase.");
+        }
+    }
+    Cycle_t cycle = current_time + delay + latency;
+
+    // Events are collected into a per-thread scratch array since the
+    // caller's array holds Event pointers and tools may delete events
+    // before they are inserted.
+    thread_local std::vector<Activity*> batch;
+    batch.clear();
+    batch.reserve(n);
+
+    for ( size_t i = 0; i < n; ++i ) {
+        Event* event = events[i];
+        if ( event == nullptr ) {
+            event = new NullEvent();
+        }
+        event->setDeliveryTime(cycle);
+        event->setDeliveryInfo(tag, delivery_info);
+
+#if __SST_DEBUG_EVENT_TRACKING__
+        event->addSendComponent(getSendingComponentName(), getSendingComponentType(), getSendingPort());
+        event->addRecvComponent(pair_link->getSendingComponentName(), pair_link->getSendingComponentType(),
+            pair_link->getSendingPort());
+#endif
+
+        if ( has_extras ) {
+            if ( ToolList* tools = getAttachedTools() ) {
+                for ( auto& x : *tools ) {
+                    x.first->eventSent(x.second, event);
+                    if ( nullptr == event ) break;
+                }
+                // Check to see if the event was deleted.  If so, skip it.
+                if ( nullptr == event ) continue;
+            }
+        }
+        batch.push_back(event);
+    }
+    if ( !batch.empty() ) send_queue->insertBatch(batch.data(), batch.size());
+}
+
+void
+Link::sendBatch_sync(Activity** events, size_t n)
+{
+    // Events are compacted into the front of the array as they are
+    // processed (tools may delete them).  Consecutive events going to
+    // the same queue are inserted as a single batch.
+    ActivityQueue* queue = nullptr;
+    size_t         start = 0;
+    size_t         count = 0;
+    for ( size_t i = 0; i < n; ++i ) {
+        Event* event = static_cast<Event*>(events[i]);
+        Link*  link  = event->getDeliveryLink();
+
+        // Delivery time is the time the event was sent plus the
+        // latency of the sending link.  Add this link's latency the
+        // same way send() would.
+        event->setDeliveryTime(event->getDeliveryTime() + link->latency);
+        event->setDeliveryInfo(link->tag, link->delivery_info);
+
+#if __SST_DEBUG_EVENT_TRACKING__
+        event->addSendComponent(
+            link->getSendingComponentName(), link->getSendingComponentType(), link->getSendingPort());
+        event->addRecvComponent(link->pair_link->getSendingComponentName(),
+            link->pair_link->getSendingComponentType(), link->pair_link->getSendingPort());
+#endif
+
+        if ( link->has_extras ) {
+            if ( ToolList* tools = link->getAttachedTools() ) {
+                for ( auto& x : *tools ) {
+                    x.first->eventSent(x.second, event);
+                    if ( nullptr == event ) break;
+                }
+                // Check to see if the event was deleted.  If so, skip it.
+                if ( nullptr == event ) continue;
+            }
+        }
+
+        if ( link->send_queue != queue ) {
+            if ( count != start ) queue->insertBatch(&events[start], count - start);
+            queue = link->send_queue;
+            start = count;
+        }
+        events[count++] = event;
+    }
+    if ( count != start ) queue->insertBatch(&events[start], count - start);
+}
+
 
 Event*
 Link::recv()
@@ -735,8 +890,9 @@ Link::sendUntimedData(Event* data)
 
     send_queue->insert(data);
 #if __SST_DEBUG_EVENT_TRACKING__
-    data->addSendComponent(comp, ctype, port);
-    data->addRecvComponent(pair_link->comp, pair_link->ctype, pair_link->port);
+    data->addSendComponent(getSendingComponentName(), getSendingComponentType(), getSendingPort());
+    data->addRecvComponent(pair_link->getSendingComponentName(), pair_link->getSendingComponentType(),
+        pair_link->getSendingPort());
 #endif
 }
 
@@ -842,24 +998,101 @@ Link::createUniqueGlobalLinkName(RankInfo local_rank, uintptr_t local_ptr, RankI
 void
 Link::attachTool(AttachPoint* tool, const AttachPointMetaData& mdata)
 {
-    if ( !attached_tools ) attached_tools = new ToolList();
     auto key = tool->registerLinkAttachTool(mdata);
-    attached_tools->push_back(std::make_pair(tool, key));
+    getExtras().tools.push_back(std::make_pair(tool, key));
 }
 
 void
 Link::detachTool(AttachPoint* tool)
 {
-    if ( !attached_tools ) return;
+    ToolList* tools = getAttachedTools();
+    if ( !tools ) return;
 
-    for ( auto x = attached_tools->begin(); x != attached_tools->end(); ++x ) {
+    for ( auto x = tools->begin(); x != tools->end(); ++x ) {
         if ( x->first == tool ) {
-            attached_tools->erase(x);
+            tools->erase(x);
             break;
         }
     }
 }
 
+Link::Extras&
+Link::getExtras()
+{
+    ExtrasTable& table = getExtrasTable();
+    if ( table.frozen.load(std::memory_order_acquire) ) {
+        Simulation_impl::getSimulation()->getSimulationOutput().fatal(
+            CALL_INFO, 1, "ERROR: Cannot add attached tools or sending component info to a link during run()\n");
+    }
+    std::lock_guard<Core::ThreadSafe::Spinlock> lock(table.lock);
+    has_extras = true;
+    return table.map[this];
+}
+
+Link::Extras*
+Link::findExtras() const
+{
+    if ( !has_extras ) return nullptr;
+    ExtrasTable& table = getExtrasTable();
+    if ( table.frozen.load(std::memory_order_acquire) ) {
+        auto it = table.map.find(this);
+        return it == table.map.end() ? nullptr : &it->second;
+    }
+    std::lock_guard<Core::ThreadSafe::Spinlock> lock(table.lock);
+    auto                                        it = table.map.find(this);
+    return it == table.map.end() ? nullptr : &it->second;
+}
+
+void
+Link::freezeExtras(bool frozen)
+{
+    getExtrasTable().frozen.store(frozen, std::memory_order_release);
+}
+
+Link::ToolList*
+Link::getAttachedTools() const
+{
+    Extras* extras = findExtras();
+    if ( !extras || extras->tools.empty() ) return nullptr;
+    return &extras->tools;
+}
+
+#ifdef __SST_DEBUG_EVENT_TRACKING__
+void
+Link::setSendingComponentInfo(const std::string& comp_in, const std::string& type_in, const std::string& port_in)
+{
+    Extras& extras = getExtras();
+    extras.comp    = comp_in;
+    extras.ctype   = type_in;
+    extras.port    = port_in;
+}
+
+// The getters don't create an entry, so they can be called on the
+// pair link, which may be owned by another thread
+static const std::string no_sending_info;
+
+const std::string&
+Link::getSendingComponentName() const
+{
+    Extras* extras = findExtras();
+    return extras ? extras->comp : no_sending_info;
+}
+
+const std::string&
+Link::getSendingComponentType() const
+{
+    Extras* extras = findExtras();
+    return extras ? extras->ctype : no_sending_info;
+}
+
+const std::string&
+Link::getSendingPort() const
+{
+    Extras* extras = findExtras();
+    return extras ? extras->port : no_sending_info;
+}
+#endif
+
 void
 Link::AttachPoint::serializeEventAttachPointKey(
     SST::Core::Serialization::serializer& UNUSED(ser), uintptr_t& UNUSED(key))
@@ -52,11 +52,16 @@ class SST::Core::Serialization::serialize_impl<Link*>
 };
 
 
-/** Link between two components. Carries events */
-class alignas(64) Link
+/** Link between two components. Carries events
+
+    Links are allocated from Core::LinkStorage.  Data that most links
+    don't use (attached tools and the names used for event tracking)
+    is kept in a side table rather than in the Link itself.
+ */
+class Link
 {
-    enum Type_t : uint16_t { POLL, HANDLER, SYNC, UNINITIALIZED };
-    enum Mode_t : uint16_t { INIT, RUN, COMPLETE };
+    enum Type_t : uint8_t { POLL, HANDLER, SYNC, UNINITIALIZED };
+    enum Mode_t : uint8_t { INIT, RUN, COMPLETE };
 
     friend class SST::Core::Serialization::serialize_impl<Link*>;
 
@@ -130,6 +135,16 @@ public:
 
     ~Link();
 
+    static void* operator new(std::size_t size);
+    static void  operator delete(void* ptr, std::size_t size);
+
+    /** Freezes or thaws the side table holding attached tools and
+     * sending component info.  While frozen, no entries can be added
+     * and lookups are done without taking the lock.  Only to be
+     * called by the core, on one thread, while no links are in use.
+     */
+    static void freezeExtras(bool frozen);
+
     /** Set additional Latency to be added to events being sent out of this link
      * @param cycles Number of Cycles to be added
      * @param timebase Base Units of cycles
@@ -218,6 +233,48 @@ public:
      */
     inline void send(Event* event) { send_impl(0, event); }
 
+    /** Send a set of events over the link with the same additional
+     * delay.  This is equivalent to calling send() on each event in
+     * order, but the events are inserted into the destination queue
+     * with a single call.  Entries may be nullptr, in which case a
+     * NullEvent is sent in their place, just like send().
+     * @param delay - additional delay
+     * @param tc - time converter to specify units for the additional delay
+     * @param events - pointer to the first event to send
+     * @param n - number of events to send
+     */
+    inline void sendBatch(SimTime_t delay, TimeConverter tc, Event** events, size_t n)
+    {
+        sendBatch_impl(tc.convertToCoreTime(delay), events, n);
+    }
+
+    /** Send a set of events with additional delay specified by the
+     * Link's default timebase.  See sendBatch(SimTime_t,
+     * TimeConverter, Event**, size_t).
+     * @param delay The additional delay, in units of the default Link timebase
+     * @param events Pointer to the first event to send
+     * @param n Number of events to send
+     */
+    inline void sendBatch(SimTime_t delay, Event** events, size_t n)
+    {
+        sendBatch_impl(delay * defaultTimeBase, events, n);
+    }
+
+    /** Send a set of events with additional delay specified by the
+     * Link's default timebase.
+     * @param delay The additional delay, in units of the default Link timebase
+     * @param events The events to send
+     */
+    inline void sendBatch(SimTime_t delay, const std::vector<Event*>& events)
+    {
+        sendBatch_impl(delay * defaultTimeBase, events.data(), events.size());
+    }
+
+    /** Send a set of events with the Link's default delay
+     * @param events The events to send
+     */
+    inline void sendBatch(const std::vector<Event*>& events) { sendBatch_impl(0, events.data(), events.size()); }
+
 
     /** Retrieve a pending event from the Link. For links which do not
      * have a set event handler, they can be polled with this function.
@@ -272,16 +329,11 @@ public:
     bool isConfigured() { return type != UNINITIALIZED; }
 
 #ifdef __SST_DEBUG_EVENT_TRACKING__
-    void setSendingComponentInfo(const std::string& comp_in, const std::string& type_in, const std::string& port_in)
-    {
-        comp  = comp_in;
-        ctype = type_in;
-        port  = port_in;
-    }
+    void setSendingComponentInfo(const std::string& comp_in, const std::string& type_in, const std::string& port_in);
 
-    const std::string& getSendingComponentName() { return comp; }
-    const std::string& getSendingComponentType() { return ctype; }
-    const std::string& getSendingPort() { return port; }
+    const std::string& getSendingComponentName() const;
+    const std::string& getSendingComponentType() const;
+    const std::string& getSendingPort() const;
 
 #endif
 
@@ -304,6 +356,16 @@ protected:
      */
     void send_impl(SimTime_t delay, Event* event);
 
+    /** Send a set of events over the link with the same additional
+     * delay.  The link mode is only checked once and the events are
+     * passed to the send queue with one call to
+     * ActivityQueue::insertBatch().
+     * @param delay - additional total delay to add
+     * @param events - pointer to the first event to send
+     * @param n - number of events to send
+     */
+    void sendBatch_impl(SimTime_t delay, Event* const* events, size_t n);
+
     /**
        Updates the delivery info in an event.  This is used during a
        restart and is implemented here because Link is a friend of
@@ -362,6 +424,8 @@ private:
     SimTime_t& current_time;
     Type_t     type;
     Mode_t     mode;
+    /** True if there is an entry for this link in the side table */
+    bool       has_extras;
     LinkId_t   tag;
 
     /** Create a new link with a given tag
@@ -390,6 +454,19 @@ private:
     void setLatency(Cycle_t lat);
 
     void sendUntimedData_sync(Event* data);
+
+    /**
+       Send a set of events received by a sync object on their
+       delivery links.  This is equivalent to calling send() with the
+       remaining delay on each event's delivery link, but events going
+       to the same queue are inserted with a single call to
+       ActivityQueue::insertBatch().  The contents of the array are
+       overwritten.
+
+       @param events Pointer to the first event
+       @param n Number of events
+     */
+    static void sendBatch_sync(Activity** events, size_t n);
     void finalizeConfiguration();
     void prepareForComplete();
 
@@ -402,7 +479,24 @@ private:
 
 
     using ToolList = std::vector<std::pair<AttachPoint*, uintptr_t>>;
-    ToolList* attached_tools;
+
+    /** Rarely used data for a Link, kept in a side table */
+    struct Extras;
+    struct ExtrasTable;
+    static ExtrasTable& getExtrasTable();
+
+    /** Returns the side table entry for this link, creating it if
+     * needed.  Can only be called while the side table is not frozen.
+     */
+    Extras& getExtras();
+
+    /** Returns the side table entry for this link, or nullptr if there
+     * is none.  Never creates an entry.
+     */
+    Extras* findExtras() const;
+
+    /** Returns the tools attached to the link, or nullptr if there are none */
+    ToolList* getAttachedTools() const;
 
     /** Manually set the default time base
      * @param factor SimTime_T defining the timebase factor
@@ -412,12 +506,6 @@ private:
     /** Set the default time base fo uninitialized */
     void resetDefaultTimeBase() { defaultTimeBase = 0; }
 
-
-#ifdef __SST_DEBUG_EVENT_TRACKING__
-    std::string comp;
-    std::string ctype;
-    std::string port;
-#endif
 };
 
 /** Self Links are links from a component to itself */
@@ -29,6 +29,7 @@ REENABLE_WARNING
 #include "sst/core/cputimer.h"
 #include "sst/core/exit.h"
 #include "sst/core/factory.h"
+#include "sst/core/impl/linkStorage.h"
 #include "sst/core/iouse.h"
 #include "sst/core/link.h"
 #include "sst/core/mempool.h"
@@ -688,8 +689,13 @@ start_simulation(uint32_t tid, SimThreadInfo_t& info, Core::ThreadSafe::Barrier&
     /* Run Simulation */
     if ( cfg.runMode() == SimulationRunMode::RUN || cfg.runMode() == SimulationRunMode::BOTH ) {
         if ( tid == 0 ) Simulation_impl::basicPerf.beginRegion("run");
+        // Links are fully wired, so the link side table can be read
+        // without locking while the simulation runs
+        if ( tid == 0 ) Link::freezeExtras(true);
+        barrier.wait();
         sim->run();
         barrier.wait();
+        if ( tid == 0 ) Link::freezeExtras(false);
         if ( tid == 0 ) Simulation_impl::basicPerf.endRegion("run");
 
         /* Adjust clocks at simulation end to
@@ -1425,7 +1431,16 @@ main(int argc, char* argv[])
     Simulation_impl::resizeBarriers(world_size.thread);
     CheckpointAction::barrier.resize(world_size.thread);
 #ifdef USE_MEMPOOL
-    MemPoolAccessor::initializeGlobalData(world_size.thread, cfg.cache_align_mempools());
+    MemPoolAccessor::initializeGlobalData(world_size.thread, cfg.cache_align_mempools(), cfg.hugepage_mempools());
+    if ( cfg.mempool_profile() != "" ) {
+        // On multi-rank runs, each rank writes its stats to a file
+        // with its rank appended, so read the one for this rank
+        std::string profile = cfg.mempool_profile();
+        if ( world_size.rank > 1 ) profile += std::to_string(myRank.rank);
+        if ( !MemPoolAccessor::loadPoolProfile(profile) ) {
+            g_output.fatal(CALL_INFO, 1, "ERROR: Unable to open mempool profile: %s\n", profile.c_str());
+        }
+    }
 #endif
 
     std::vector<std::thread>     threads(world_size.thread);
@@ -1496,6 +1511,10 @@ main(int argc, char* argv[])
     int64_t active_activities = 0, global_active_activities = 0;
     Core::MemPoolAccessor::getMemPoolUsage(mempool_size, active_activities);
 
+    uint64_t link_storage_size = 0, max_link_storage_size = 0, global_link_storage_size = 0;
+    uint64_t num_links = 0, global_links = 0;
+    Core::LinkStorage::getUsage(link_storage_size, num_links);
+
 #ifdef SST_CONFIG_HAVE_MPI
     uint64_t local_sync_data_size = threadInfo[0].sync_data_size;
 
@@ -1506,6 +1525,9 @@ main(int argc, char* argv[])
     MPI_Allreduce(&mempool_size, &max_mempool_size, 1, MPI_UINT64_T, MPI_MAX, MPI_COMM_WORLD);
     MPI_Allreduce(&mempool_size, &global_mempool_size, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
     MPI_Allreduce(&active_activities, &global_active_activities, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+    MPI_Allreduce(&link_storage_size, &max_link_storage_size, 1, MPI_UINT64_T, MPI_MAX, MPI_COMM_WORLD);
+    MPI_Allreduce(&link_storage_size, &global_link_storage_size, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+    MPI_Allreduce(&num_links, &global_links, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
 #else
     global_max_tv_depth       = local_max_tv_depth;
     global_current_tv_depth   = local_current_tv_depth;
@@ -1514,6 +1536,9 @@ main(int argc, char* argv[])
     max_mempool_size          = mempool_size;
     global_mempool_size       = mempool_size;
     global_active_activities  = active_activities;
+    max_link_storage_size     = link_storage_size;
+    global_link_storage_size  = link_storage_size;
+    global_links              = num_links;
 #endif
 
     // These functions invoke MPI_Allreduce
@@ -1541,6 +1566,9 @@ main(int argc, char* argv[])
             timingOutput.set(TimingOutput::Key::GLOBAL_SYNC_DATA_SIZE, global_sync_data_size);
             timingOutput.set(TimingOutput::Key::MAX_MEMPOOL_SIZE, (uint64_t)max_mempool_size);
             timingOutput.set(TimingOutput::Key::GLOBAL_MEMPOOL_SIZE, (uint64_t)global_mempool_size);
+            timingOutput.set(TimingOutput::Key::MAX_LINK_STORAGE_SIZE, max_link_storage_size);
+            timingOutput.set(TimingOutput::Key::GLOBAL_LINK_STORAGE_SIZE, global_link_storage_size);
+            timingOutput.set(TimingOutput::Key::GLOBAL_LINKS, global_links);
             timingOutput.set(TimingOutput::Key::MAX_BUILD_TIME, max_build_time);
             timingOutput.set(TimingOutput::Key::MAX_RUN_TIME, max_run_time);
             timingOutput.set(TimingOutput::Key::MAX_TOTAL_TIME, max_total_time);
@@ -1554,6 +1582,20 @@ main(int argc, char* argv[])
         }
     }
 
+#ifdef USE_MEMPOOL
+    if ( cfg.hugepage_mempools() ) {
+        for ( uint32_t i = 0; i < world_size.thread; i++ ) {
+            uint64_t huge_bytes   = 0;
+            uint64_t normal_bytes = 0;
+            MemPoolAccessor::getPageUsage(i, huge_bytes, normal_bytes);
+            g_output.verbose(CALL_INFO, 1, 0,
+                "# Mempool arenas on rank %" PRIu32 " thread %" PRIu32 ": %" PRIu64 " bytes in huge pages, %" PRIu64
+                " bytes in normal pages\n",
+                myRank.rank, i, huge_bytes, normal_bytes);
+        }
+    }
+#endif
+
 #ifdef SST_CONFIG_HAVE_MPI
     if ( 0 == myRank.rank ) {
 #endif
@@ -1589,6 +1631,17 @@ main(int argc, char* argv[])
         }
         MemPoolAccessor::printUndeletedMemPoolItems("  ", out);
     }
+
+    if ( cfg.output_mempool_stats() != "" ) {
+        Output out("", 0, 0, Output::FILE, cfg.output_mempool_stats());
+        if ( cfg.output_mempool_stats() == "STDOUT" || cfg.output_mempool_stats() == "stdout" ) {
+            out.setOutputLocation(Output::STDOUT);
+        }
+        if ( cfg.output_mempool_stats() == "STDERR" || cfg.output_mempool_stats() == "stderr" ) {
+            out.setOutputLocation(Output::STDERR);
+        }
+        MemPoolAccessor::printMemPoolStats(out, myRank.rank);
+    }
 #endif
 
 #ifdef SST_CONFIG_HAVE_MPI
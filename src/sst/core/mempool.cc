@@ -17,11 +17,17 @@
 #include "sst/core/output.h"
 #include "sst/core/threadsafe.h"
 
+#include <cinttypes>
 #include <cstdint>
+#include <cxxabi.h>
+#include <fstream>
 #include <list>
+#include <map>
 #include <sstream>
 #include <sys/mman.h>
+#include <sys/syscall.h>
 #include <sys/time.h>
+#include <unistd.h>
 #include <vector>
 
 namespace SST::Core {
@@ -97,6 +103,107 @@ public:
 // Controls whether or not the mempools cache align their entries
 static bool memPoolCacheAlign = false;
 
+// Controls whether or not the mempool arenas are backed by huge pages
+// and bound to the NUMA node of the allocating thread
+static bool memPoolHugePages = false;
+
+// Size of the huge pages used to back arenas
+static constexpr size_t hugePageSize = 2 << 20;
+
+// NUMA node the thread was running on when its mempools were
+// initialized, or -1 if it isn't known
+thread_local int numa_node = -1;
+
+// The 8 byte header in front of each item holds the requested size in
+// the low bits and the thread that allocated the item in the high
+// bits.  A header of 0 marks a free entry.
+static constexpr int      headerThreadShift = 48;
+static constexpr uint64_t headerSizeMask    = (1ull << headerThreadShift) - 1;
+static constexpr uint64_t headerThreadMask  = (1ull << (64 - headerThreadShift)) - 1;
+
+// Thread field of the header for thread.  thread_num is -1 until
+// initializeLocalData() is called, so mask it to the width of the
+// field to get the same value when packing and when comparing.
+static inline uint64_t
+headerThread(int thread)
+{
+    return static_cast<uint64_t>(thread) & headerThreadMask;
+}
+
+
+/**
+   Binds the pages in the region to numa_node.  This has to be done
+   before the pages are first touched.  MPOL_PREFERRED is used so that
+   allocations fall back to other nodes rather than fail when the
+   local node is full.
+ */
+static void
+bindToNumaNode(void* addr, size_t len)
+{
+#if defined(__linux__) && defined(SYS_mbind)
+    if ( numa_node < 0 ) return;
+    const int                  bits_per_word = sizeof(unsigned long) * 8;
+    std::vector<unsigned long> nodemask(numa_node / bits_per_word + 1, 0);
+    nodemask[numa_node / bits_per_word] = 1UL << (numa_node % bits_per_word);
+    const int MPOL_PREFERRED_MODE       = 1;
+    // Failure isn't fatal, the pages just end up wherever they are
+    // first touched
+    syscall(SYS_mbind, addr, len, MPOL_PREFERRED_MODE, nodemask.data(), nodemask.size() * bits_per_word + 1, 0);
+#else
+    (void)addr;
+    (void)len;
+#endif
+}
+
+
+/**
+   Maps a new arena.  If huge pages are enabled, the arena is first
+   requested from the reserved huge page pool.  If none are available,
+   a normal mapping aligned to the huge page size is used instead and
+   the kernel is advised to back it with transparent huge pages.
+   @param size Size of the arena in bytes
+   @param huge Set to true if the arena is backed by reserved huge pages
+   @return the arena, or nullptr if the mapping failed
+ */
+static uint8_t*
+mapArena(size_t size, bool& huge)
+{
+    huge = false;
+    if ( !memPoolHugePages ) {
+        void* arena = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
+        return MAP_FAILED == arena ? nullptr : (uint8_t*)arena;
+    }
+
+    uint8_t* arena = nullptr;
+#ifdef MAP_HUGETLB
+    if ( size % hugePageSize == 0 ) {
+        void* map = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON | MAP_HUGETLB, -1, 0);
+        if ( MAP_FAILED != map ) {
+            arena = (uint8_t*)map;
+            huge  = true;
+        }
+    }
+#endif
+    if ( nullptr == arena ) {
+        // Over allocate so the arena can be aligned to a huge page,
+        // then give back the pieces on either side
+        size_t map_size = size + hugePageSize;
+        void*  map      = mmap(nullptr, map_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
+        if ( MAP_FAILED == map ) return nullptr;
+        uintptr_t start   = (uintptr_t)map;
+        uintptr_t aligned = (start + hugePageSize - 1) & ~(uintptr_t)(hugePageSize - 1);
+        if ( aligned != start ) munmap(map, aligned - start);
+        size_t tail = (start + map_size) - (aligned + size);
+        if ( tail != 0 ) munmap((void*)(aligned + size), tail);
+        arena = (uint8_t*)aligned;
+#ifdef MADV_HUGEPAGE
+        madvise(arena, size, MADV_HUGEPAGE);
+#endif
+    }
+    bindToNumaNode(arena, size);
+    return arena;
+}
+
 
 /**
  * Simple Memory Pool class.  The class instance is only ever accessed
@@ -118,9 +225,15 @@ public:
     MemPoolNoMutex(size_t elementSize, size_t initialSize = (2 << 20)) :
         numAlloc(0),
         numFree(0),
+        numCrossThreadFree(0),
+        numOverflowOut(0),
+        numOverflowIn(0),
+        highWater(0),
+        outstanding(0),
         elemSize(elementSize),
         arenaSize(initialSize),
-        max_freelist_size(0)
+        max_freelist_size(0),
+        num_huge_arenas(0)
     {
         if ( memPoolCacheAlign ) {
             // Round up to next multiple of 64 to ensure no events are
@@ -140,7 +253,7 @@ public:
     ~MemPoolNoMutex()
     {
         for ( std::list<uint8_t*>::iterator i = arenas.begin(); i != arenas.end(); ++i ) {
-            ::free(*i);
+            munmap(*i, arenaSize);
         }
     }
 
@@ -154,34 +267,38 @@ public:
         // that fails, then alloc a new arena.
 
         numAlloc++;
+        void* ret;
 
-        // Check freelist
         if ( !freelist.empty() ) {
-            void* ret = freelist.back();
+            // Check freelist
+            ret = freelist.back();
             freelist.pop_back();
-            return ret;
         }
-
-        // Check overflow.
-        if ( !overflow.empty() ) {
-            void* ret = overflow.back();
+        else if ( !overflow.empty() ) {
+            // Check overflow.
+            ret = overflow.back();
             overflow.pop_back();
-            return ret;
         }
-
-        // Need to check the shared_overflow
-        shared_overflow.remove(elemSize, overflow);
-        if ( !overflow.empty() ) {
-            void* ret = overflow.back();
-            overflow.pop_back();
-            return ret;
+        else {
+            // Need to check the shared_overflow
+            if ( shared_overflow.remove(elemSize, overflow) ) {
+                numOverflowIn++;
+                outstanding -= overflow.size();
+            }
+            if ( overflow.empty() ) {
+                // Need to allocate a new arena
+                bool ok = allocPool();
+                if ( !ok ) return nullptr;
+                ret = freelist.back();
+                freelist.pop_back();
+            }
+            else {
+                ret = overflow.back();
+                overflow.pop_back();
+            }
         }
 
-        // Need to allocate a new arena
-        bool ok = allocPool();
-        if ( !ok ) return nullptr;
-        void* ret = freelist.back();
-        freelist.pop_back();
+        if ( ++outstanding > highWater ) highWater = outstanding;
         return ret;
     }
 
@@ -189,12 +306,15 @@ public:
     inline void free(void* ptr)
     {
         numFree++;
+        outstanding--;
         // Goes in freelist if we aren't at max capacity.  Otherwise
         // goes in overflow.
         if ( freelist.size() >= max_freelist_size ) {
             overflow.push_back(ptr);
             if ( overflow.size() == max_overflow_size ) {
+                outstanding += overflow.size();
                 shared_overflow.insert(elemSize, overflow);
+                numOverflowOut++;
             }
         }
         else {
@@ -222,31 +342,63 @@ public:
     int64_t numAlloc;
     /** Counter:  Number times elements have been freed */
     int64_t numFree;
+    /** Counter:  Number of freed elements that were allocated on another thread */
+    int64_t numCrossThreadFree;
+    /** Counter:  Number of full overflow lists given to the shared overflow */
+    int64_t numOverflowOut;
+    /** Counter:  Number of overflow lists taken from the shared overflow */
+    int64_t numOverflowIn;
+    /** High-water mark of arena entries in use.  Entries handed to
+        or taken from other threads through the shared overflow count
+        against the pool they end up in, so this is the number of
+        entries the pool's arenas have to be able to supply. */
+    int64_t highWater;
+    /** Current number of arena entries in use (see highWater) */
+    int64_t outstanding;
 
     size_t getArenaSize() const { return arenaSize; }
     size_t getNumArenas() const { return arenas.size(); }
     size_t getElementSize() const { return elemSize; }
     size_t getAllocSize() const { return allocSize; }
 
+    /** Bytes in arenas backed by reserved huge pages */
+    uint64_t getHugePageBytes() const { return num_huge_arenas * arenaSize; }
+    /** Bytes in arenas backed by normal pages */
+    uint64_t getNormalPageBytes() const { return (arenas.size() - num_huge_arenas) * arenaSize; }
+
     const std::list<uint8_t*>& getArenas() { return arenas; }
 
+    /** Grows the pool to at least count arenas with a single mapping */
+    bool reserveArenas(size_t count)
+    {
+        if ( count <= arenas.size() ) return true;
+        return allocPool(count - arenas.size());
+    }
+
 private:
     // allocPool will only ever be called by one thread, no need for locking
     // version that will cache align each memory chunk for an event
-    bool allocPool()
+    bool allocPool(size_t count = 1)
     {
-        uint8_t* newPool = (uint8_t*)mmap(nullptr, arenaSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
-        if ( MAP_FAILED == newPool ) {
+        bool     huge    = false;
+        uint8_t* newPool = mapArena(arenaSize * count, huge);
+        if ( nullptr == newPool ) {
             return false;
         }
-        std::memset(newPool, 0, arenaSize);
-        arenas.push_back(newPool);
+        std::memset(newPool, 0, arenaSize * count);
         size_t nelem = arenaSize / allocSize;
-        for ( size_t i = 0; i < nelem; i++ ) {
-            uint64_t* ptr = (uint64_t*)(newPool + (allocSize * i));
-            freelist.push_back(ptr);
+        // Each arenaSize piece of the mapping is tracked as its own
+        // arena
+        for ( size_t a = 0; a < count; a++ ) {
+            uint8_t* arena = newPool + (arenaSize * a);
+            arenas.push_back(arena);
+            if ( huge ) num_huge_arenas++;
+            for ( size_t i = 0; i < nelem; i++ ) {
+                uint64_t* ptr = (uint64_t*)(arena + (allocSize * i));
+                freelist.push_back(ptr);
+            }
         }
-        max_freelist_size += nelem;
+        max_freelist_size += nelem * count;
         return true;
     }
 
@@ -255,6 +407,7 @@ private:
     size_t max_freelist_size;
     size_t max_overflow_size;
     size_t allocSize;
+    size_t num_huge_arenas;
 
     std::list<uint8_t*> arenas;
 };
@@ -284,6 +437,10 @@ struct PoolInfo_t
 // call delete[] if we use an array with new.
 static std::vector<std::vector<PoolInfo_t>> memPoolThreadVector;
 
+// Number of arenas to create up front for each pool size on each
+// thread, read from a profile written by a previous run
+static std::vector<std::vector<std::pair<size_t, size_t>>> memPoolProfile;
+
 // My local thread number
 thread_local int                      thread_num = -1;
 thread_local std::vector<PoolInfo_t>* myPools;
@@ -312,13 +469,14 @@ getMemPool(std::size_t size) noexcept
 
 
 void
-MemPoolAccessor::initializeGlobalData(int num_threads, bool cache_align)
+MemPoolAccessor::initializeGlobalData(int num_threads, bool cache_align, bool huge_pages)
 {
     // Only resize once
     if ( memPoolThreadVector.size() == 0 ) {
         memPoolThreadVector.resize(num_threads);
     }
     memPoolCacheAlign = cache_align;
+    memPoolHugePages  = huge_pages;
 }
 
 void
@@ -329,9 +487,48 @@ MemPoolAccessor::initializeLocalData(int thread)
     if ( thread_num == -1 ) {
         thread_num = thread;
         myPools    = &memPoolThreadVector[thread_num];
+#if defined(__linux__) && defined(SYS_getcpu)
+        // Arenas for this thread will be bound to the node it is
+        // running on now
+        unsigned cpu, node;
+        if ( memPoolHugePages && 0 == syscall(SYS_getcpu, &cpu, &node, nullptr) ) {
+            numa_node = node;
+        }
+#endif
+        // Create any pools the profile asks for with all their arenas
+        if ( (size_t)thread_num < memPoolProfile.size() ) {
+            for ( auto& x : memPoolProfile[thread_num] ) {
+                getMemPool(x.first)->reserveArenas(x.second);
+            }
+        }
     }
 }
 
+bool
+MemPoolAccessor::loadPoolProfile(const std::string& filename)
+{
+    std::ifstream file(filename);
+    if ( !file.is_open() ) return false;
+
+    memPoolProfile.clear();
+    memPoolProfile.resize(memPoolThreadVector.size());
+
+    // Only the pool lines are needed:
+    // pool <thread> <size> <alloc size> <arenas> ...
+    std::string line;
+    while ( std::getline(file, line) ) {
+        std::stringstream ss(line);
+        std::string       tag;
+        size_t            thread, size, alloc_size, arenas;
+        ss >> tag;
+        if ( tag != "pool" ) continue;
+        if ( !(ss >> thread >> size >> alloc_size >> arenas) ) continue;
+        if ( thread >= memPoolProfile.size() || arenas == 0 ) continue;
+        memPoolProfile[thread].emplace_back(size, arenas);
+    }
+    return true;
+}
+
 
 size_t
 MemPoolAccessor::getArenaSize(size_t size)
@@ -371,6 +568,99 @@ MemPoolAccessor::getMemPoolUsage(int64_t& bytes, int64_t& active_entries)
     active_entries = alloced - freed;
 }
 
+void
+MemPoolAccessor::getPageUsage(int thread, uint64_t& huge_bytes, uint64_t& normal_bytes)
+{
+    huge_bytes   = 0;
+    normal_bytes = 0;
+    if ( thread < 0 || (size_t)thread >= memPoolThreadVector.size() ) return;
+    for ( auto&& entry : memPoolThreadVector[thread] ) {
+        huge_bytes += entry.pool->getHugePageBytes();
+        normal_bytes += entry.pool->getNormalPageBytes();
+    }
+}
+
+void
+MemPoolAccessor::printMemPoolStats(Output& out, int rank)
+{
+    out.output("# Mempool usage for rank %d\n", rank);
+    out.output("# pool <thread> <size> <alloc size> <arenas> <allocs> <frees> <cross-thread frees> <overflow lists out> "
+               "<overflow lists in> <high water>\n");
+    for ( size_t thread = 0; thread < memPoolThreadVector.size(); ++thread ) {
+        for ( auto&& entry : memPoolThreadVector[thread] ) {
+            MemPoolNoMutex* pool = entry.pool;
+            out.output("pool %zu %zu %zu %zu %" PRId64 " %" PRId64 " %" PRId64 " %" PRId64 " %" PRId64 " %" PRId64 "\n",
+                thread, entry.size, pool->getAllocSize(), pool->getNumArenas(), pool->numAlloc, pool->numFree,
+                pool->numCrossThreadFree, pool->numOverflowOut, pool->numOverflowIn, pool->highWater);
+        }
+    }
+
+    // Class names are only known for entries that are still live, so
+    // walk the arenas and count them
+    out.output("# live <thread> <size> <entries> <class>\n");
+    for ( size_t thread = 0; thread < memPoolThreadVector.size(); ++thread ) {
+        for ( auto&& entry : memPoolThreadVector[thread] ) {
+            std::map<std::string, uint64_t> live;
+            size_t                          arenaSize = entry.pool->getArenaSize();
+            size_t                          allocSize = entry.pool->getAllocSize();
+            size_t                          nelem     = arenaSize / allocSize;
+            for ( auto* arena : entry.pool->getArenas() ) {
+                for ( size_t j = 0; j < nelem; j++ ) {
+                    uint64_t* ptr = (uint64_t*)(arena + (allocSize * j));
+                    if ( *ptr != 0 ) {
+                        live[((MemPoolItem*)(ptr + 1))->cls_name()]++;
+                    }
+                }
+            }
+            for ( auto& x : live ) {
+                // Names that come from typeid need to be demangled
+                int         status;
+                char*       demangled = abi::__cxa_demangle(x.first.c_str(), nullptr, nullptr, &status);
+                std::string name      = (status == 0) ? demangled : x.first;
+                std::free(demangled);
+                out.output("live %zu %zu %" PRIu64 " %s\n", thread, entry.size, x.second, name.c_str());
+            }
+        }
+    }
+}
+
+void
+MemPoolAccessor::printMemPoolSummary(const std::string& header, Output& out)
+{
+    struct Summary
+    {
+        size_t  arenas        = 0;
+        int64_t allocs        = 0;
+        int64_t frees         = 0;
+        int64_t cross_thread  = 0;
+        int64_t overflow_out  = 0;
+        int64_t overflow_in   = 0;
+        int64_t high_water    = 0;
+    };
+
+    // Sum each size class across the threads
+    std::map<size_t, Summary> sizes;
+    for ( auto&& pool_group : memPoolThreadVector ) {
+        for ( auto&& entry : pool_group ) {
+            Summary& s = sizes[entry.size];
+            s.arenas += entry.pool->getNumArenas();
+            s.allocs += entry.pool->numAlloc;
+            s.frees += entry.pool->numFree;
+            s.cross_thread += entry.pool->numCrossThreadFree;
+            s.overflow_out += entry.pool->numOverflowOut;
+            s.overflow_in += entry.pool->numOverflowIn;
+            s.high_water += entry.pool->highWater;
+        }
+    }
+
+    for ( auto& x : sizes ) {
+        out.output("%sSize %zu: %zu arenas, %" PRId64 " allocs, %" PRId64 " frees (%" PRId64
+                   " cross-thread), %" PRId64 "/%" PRId64 " overflow lists out/in, high water %" PRId64 "\n",
+            header.c_str(), x.first, x.second.arenas, x.second.allocs, x.second.frees, x.second.cross_thread,
+            x.second.overflow_out, x.second.overflow_in, x.second.high_water);
+    }
+}
+
 void
 MemPoolAccessor::printUndeletedMemPoolItems(const std::string& header, Output& out)
 {
@@ -408,7 +698,7 @@ MemPoolItem::operator new(std::size_t size) noexcept
         fprintf(stderr, "Memory Pool failed to allocate a new object.  Error: %s\n", strerror(errno));
         return nullptr;
     }
-    *ptr = size;
+    *ptr = size | (headerThread(thread_num) << headerThreadShift);
     return (void*)(ptr + 1);
 }
 
@@ -421,9 +711,10 @@ MemPoolItem::operator delete(void* ptr)
      * 2b) Set Pool_id field to 0 to allow tracking
      * 3) Return to local pool
      */
-    uint64_t* ptr8 = ((uint64_t*)ptr) - 1;
-    uint64_t  size = *ptr8;
-    if ( *ptr8 == 0 ) {
+    uint64_t* ptr8   = ((uint64_t*)ptr) - 1;
+    uint64_t  header = *ptr8;
+    uint64_t  size   = header & headerSizeMask;
+    if ( header == 0 ) {
         // This item has already been deleted, error
         Output::getDefaultObject().fatal(CALL_INFO, 1, "ERROR: Double deletion of mempool item detected: %s",
             static_cast<MemPoolItem*>(ptr)->toString().c_str());
@@ -432,6 +723,7 @@ MemPoolItem::operator delete(void* ptr)
 
     // find the pool
     MemPoolNoMutex* pool = getMemPool(size);
+    if ( (header >> headerThreadShift) != headerThread(thread_num) ) pool->numCrossThreadFree++;
     pool->free(ptr8);
 }
 
@@ -440,7 +732,7 @@ MemPoolItem::operator delete(void* ptr)
 
 
 void
-MemPoolAccessor::initializeGlobalData(int UNUSED(num_threads), bool UNUSED(cache_align))
+MemPoolAccessor::initializeGlobalData(int UNUSED(num_threads), bool UNUSED(cache_align), bool UNUSED(huge_pages))
 {}
 
 void
@@ -476,6 +768,27 @@ MemPoolAccessor::getMemPoolUsage(int64_t& bytes, int64_t& active_entries)
     active_entries = 0;
 }
 
+void
+MemPoolAccessor::getPageUsage(int UNUSED(thread), uint64_t& huge_bytes, uint64_t& normal_bytes)
+{
+    huge_bytes   = 0;
+    normal_bytes = 0;
+}
+
+bool
+MemPoolAccessor::loadPoolProfile(const std::string& UNUSED(filename))
+{
+    return true;
+}
+
+void
+MemPoolAccessor::printMemPoolStats(Output& UNUSED(out), int UNUSED(rank))
+{}
+
+void
+MemPoolAccessor::printMemPoolSummary(const std::string& UNUSED(header), Output& UNUSED(out))
+{}
+
 void
 MemPoolAccessor::printUndeletedMemPoolItems(const std::string& UNUSED(header), Output& UNUSED(out))
 {
@@ -43,8 +43,36 @@ public:
     // aren't enabled, then nothing will be counted.
     static void getMemPoolUsage(int64_t& bytes, int64_t& active_entries);
 
+    // Gets the bytes in the mempool arenas for the specified thread,
+    // split into arenas backed by huge pages and arenas backed by
+    // normal pages.  Arenas that could only be advised to use
+    // transparent huge pages are counted as normal pages.  If
+    // mempools aren't enabled, both will be 0.
+    static void getPageUsage(int thread, uint64_t& huge_bytes, uint64_t& normal_bytes);
+
+    // Reads a file written by printMemPoolStats() in an earlier run
+    // and records how many arenas each pool on each thread ended up
+    // with.  initializeLocalData() then creates those pools with all
+    // of their arenas up front instead of growing them one arena at a
+    // time.  Must be called after initializeGlobalData().  Returns
+    // false if the file can't be opened.
+    static bool loadPoolProfile(const std::string& filename);
+
+    // Prints usage counters for each size class on each thread of the
+    // rank: arenas, allocations, frees, cross-thread frees, overflow
+    // list transfers and high-water mark.  Also prints the number of
+    // live entries of each class.  Must only be called when no
+    // threads are allocating from the pools.
+    static void printMemPoolStats(Output& out, int rank);
+
+    // Prints one line per size class with the usage counters summed
+    // across the threads of the rank.  The counters are read without
+    // locking, so the values are approximate while the simulation is
+    // running.
+    static void printMemPoolSummary(const std::string& header, Output& out);
+
     // Initialize the global mempool data structures
-    static void initializeGlobalData(int num_threads, bool cache_align = false);
+    static void initializeGlobalData(int num_threads, bool cache_align = false, bool huge_pages = false);
 
     // Initialize the per thread mempool data structures
     static void initializeLocalData(int thread);
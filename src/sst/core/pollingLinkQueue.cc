@@ -13,52 +13,127 @@
 
 #include "sst/core/pollingLinkQueue.h"
 
+#include <algorithm>
+
 namespace SST {
 
 PollingLinkQueue::~PollingLinkQueue()
 {
     // Need to delete any events left in the queue
-    for ( auto it = data.begin(); it != data.end(); ++it ) {
-        delete *it;
+    while ( ring_count > 0 ) {
+        delete ringPop();
+    }
+    for ( auto* x : heap ) {
+        delete x;
     }
-    data.clear();
+    heap.clear();
 }
 
 bool
 PollingLinkQueue::empty()
 {
-    return data.empty();
+    return ring_count == 0 && heap.empty();
 }
 
 int
 PollingLinkQueue::size()
 {
-    return data.size();
+    return ring_count + heap.size();
 }
 
 void
 PollingLinkQueue::insert(Activity* activity)
 {
-    data.insert(activity);
+#ifdef __SST_COMPACT_ACTIVITY_KEY__
+    if ( UNLIKELY(insert_order != 0 && (insert_order & Activity::queue_order_mask) == 0) ) renumber();
+#endif
+    activity->setQueueOrder(insert_order++);
+
+    if ( ring_count == 0 || activity->getDeliveryTime() >= ringBack()->getDeliveryTime() ) {
+        ringPush(activity);
+    }
+    else {
+        heap.push_back(activity);
+        std::push_heap(heap.begin(), heap.end(), Compare_t());
+    }
 }
 
 Activity*
 PollingLinkQueue::pop()
 {
-    if ( data.size() == 0 ) return nullptr;
-    auto      it      = data.begin();
-    Activity* ret_val = (*it);
-    data.erase(it);
-    return ret_val;
+    if ( heapIsNext() ) {
+        std::pop_heap(heap.begin(), heap.end(), Compare_t());
+        Activity* ret_val = heap.back();
+        heap.pop_back();
+        return ret_val;
+    }
+    if ( ring_count == 0 ) return nullptr;
+    return ringPop();
 }
 
 Activity*
 PollingLinkQueue::front()
 {
-    if ( data.size() == 0 ) return nullptr;
-    return *data.begin();
+    if ( heapIsNext() ) return heap.front();
+    if ( ring_count == 0 ) return nullptr;
+    return ring[ring_head];
 }
 
+void
+PollingLinkQueue::ringPush(Activity* activity)
+{
+    if ( ring_count == ring.size() ) {
+        // Grow and unwrap the ring
+        std::vector<Activity*> grown(ring.empty() ? 16 : ring.size() * 2);
+        for ( size_t i = 0; i < ring_count; ++i ) {
+            grown[i] = ring[(ring_head + i) & (ring.size() - 1)];
+        }
+        ring.swap(grown);
+        ring_head = 0;
+    }
+    ring[(ring_head + ring_count) & (ring.size() - 1)] = activity;
+    ring_count++;
+}
+
+Activity*
+PollingLinkQueue::ringPop()
+{
+    Activity* ret_val = ring[ring_head];
+    ring_head         = (ring_head + 1) & (ring.size() - 1);
+    ring_count--;
+    return ret_val;
+}
+
+bool
+PollingLinkQueue::heapIsNext() const
+{
+    if ( heap.empty() ) return false;
+    if ( ring_count == 0 ) return true;
+    return Compare_t()(ring[ring_head], heap.front());
+}
+
+void
+PollingLinkQueue::drain(std::vector<Activity*>& out)
+{
+    while ( !empty() ) {
+        out.push_back(pop());
+    }
+}
+
+#ifdef __SST_COMPACT_ACTIVITY_KEY__
+void
+PollingLinkQueue::renumber()
+{
+    std::vector<Activity*> all;
+    drain(all);
+    insert_order = 0;
+    for ( auto* x : all ) {
+        x->setQueueOrder(insert_order++);
+        ringPush(x);
+    }
+}
+#endif
+
 void
 PollingLinkQueue::serialize_order(SST::Core::Serialization::serializer& ser)
 {
@@ -66,10 +141,16 @@ PollingLinkQueue::serialize_order(SST::Core::Serialization::serializer& ser)
     case SST::Core::Serialization::serializer::SIZER:
     case SST::Core::Serialization::serializer::PACK:
     {
-        size_t size = data.size();
+        // Serialize in the order the events will be returned.  Draining
+        // and reinserting keeps the relative order, and the events end
+        // up in the ring.
+        std::vector<Activity*> all;
+        drain(all);
+        size_t size = all.size();
         SST_SER(size);
-        for ( auto* x : data ) {
+        for ( auto* x : all ) {
             SST_SER(x);
+            insert(x);
         }
         break;
     }
@@ -80,8 +161,9 @@ PollingLinkQueue::serialize_order(SST::Core::Serialization::serializer& ser)
         Activity* activity;
         for ( size_t i = 0; i < size; ++i ) {
             SST_SER(activity);
-            data.insert(activity);
+            insert(activity);
         }
+        break;
     }
     case SST::Core::Serialization::serializer::MAP:
         // This version of function not called in mapping mode
@@ -14,12 +14,23 @@
 
 #include "sst/core/activityQueue.h"
 
-#include <set>
+#include <cstdint>
+#include <vector>
 
 namespace SST {
 
 /**
  * A link queue which is used for polling only.
+ *
+ * Events are returned in delivery time order, and events with the
+ * same delivery time are returned in the order they were inserted.
+ *
+ * Events on most links arrive in delivery time order, so they are
+ * appended to a ring buffer.  An event that is earlier than the last
+ * one in the ring goes into a min-heap instead, and front()/pop()
+ * take whichever of the two heads is earlier.  The queue order of
+ * each event is set to its insertion order to break ties between the
+ * two.
  */
 class PollingLinkQueue : public ActivityQueue
 {
@@ -36,7 +47,35 @@ public:
     void serialize_order(SST::Core::Serialization::serializer& ser);
 
 private:
-    std::multiset<Activity*, Activity::less<true, false, false>> data;
+    using Compare_t = Activity::greater<true, false, true>;
+
+    // Ring buffer of events in order.  The capacity is always a power
+    // of two.
+    std::vector<Activity*> ring;
+    size_t                 ring_head  = 0;
+    size_t                 ring_count = 0;
+
+    // Min-heap of events that arrived out of order
+    std::vector<Activity*> heap;
+
+    uint64_t insert_order = 0;
+
+    Activity* ringBack() const { return ring[(ring_head + ring_count - 1) & (ring.size() - 1)]; }
+    void      ringPush(Activity* activity);
+    Activity* ringPop();
+
+    // Returns true if the next event is at the top of the heap
+    bool heapIsNext() const;
+
+    // Moves all the events into a vector in the order they will be
+    // returned
+    void drain(std::vector<Activity*>& out);
+
+#ifdef __SST_COMPACT_ACTIVITY_KEY__
+    // Renumbers the insertion order of the events before it overflows
+    // the queue order field
+    void renumber();
+#endif
 };
 
 } // namespace SST
@@ -13,6 +13,7 @@
 
 #include "sst/core/realtime.h"
 
+#include "sst/core/config.h"
 #include "sst/core/cputimer.h"
 #include "sst/core/mempoolAccessor.h"
 #include "sst/core/output.h"
@@ -384,6 +385,13 @@ HeartbeatRealTimeAction::execute()
                     "\tGlobal Sync data size:           %s\n", global_sync_data_size_ua.toStringBestSI().c_str());
             }
         }
+
+#ifdef USE_MEMPOOL
+        if ( Simulation_impl::config.output_mempool_stats() != "" ) {
+            sim_output.output("\tMempool usage by size class on rank %" PRIu32 ":\n", rank.rank);
+            Core::MemPoolAccessor::printMemPoolSummary("\t  ", sim_output);
+        }
+#endif
     }
 }
 
@@ -16,6 +16,7 @@
 
 #include "sst/core/checkpointAction.h"
 #include "sst/core/clock.h"
+#include "sst/core/clockedArray.h"
 #include "sst/core/config.h"
 #include "sst/core/configGraph.h"
 #include "sst/core/exit.h"
@@ -193,9 +194,16 @@ Simulation_impl::~Simulation_impl()
     if ( checkpoint_action_->getNextCheckpointSimTime() == MAX_SIMTIME_T ) delete checkpoint_action_;
 
     // Delete the timeVortex first.  This will delete all events left
-    // in the queue, as well as the Sync, Exit and Clock objects.
+    // in the queue, as well as the Sync, Exit and ClockTick objects.
     delete timeVortex;
 
+    // Ticks for the local event schedulers were deleted with the
+    // timeVortex.  This deletes the events that were still pending.
+    for ( auto* x : local_event_schedulers_ ) {
+        delete x;
+    }
+    local_event_schedulers_.clear();
+
     // For serial runs, the sync object is not in the timevortex
     if ( num_ranks.rank == 1 && num_ranks.thread == 1 ) delete syncManager;
 
@@ -205,12 +213,24 @@ Simulation_impl::~Simulation_impl()
     // }
     // compMap.clear();
 
-    // Clocks already got deleted by timeVortex, simply clear the clockMap
+    // Clocks are kept in the ClockScheduler rather than the
+    // timeVortex, so delete them here
+    for ( auto& x : clockMap ) {
+        delete x.second;
+    }
     clockMap.clear();
 
     // Clear out Components
     compInfoMap.clear();
 
+    // ClockedArrays are owned by the core.  Components leave them
+    // when they are deleted, so this has to come after the components
+    // are cleared.
+    for ( auto& x : clockedArrayMap ) {
+        delete x.second;
+    }
+    clockedArrayMap.clear();
+
     // Clean up the profile tools
     for ( auto x : profile_tools )
         delete x.second;
@@ -232,6 +252,8 @@ Simulation_impl::~Simulation_impl()
     //         delete map_it->second;
     //     }
     // }
+
+    if ( thread_instance_ == this ) thread_instance_ = nullptr;
 }
 
 Simulation_impl*
@@ -250,6 +272,7 @@ Simulation_impl::createSimulation(
     instanceMap[tid] = instance;
     instanceVec_.resize(num_ranks.thread);
     instanceVec_[my_rank.thread] = instance;
+    thread_instance_             = instance;
     instance->initializeProfileTools(config.enabled_profiling());
 
     return instance;
@@ -273,6 +296,7 @@ Simulation_impl::Simulation_impl(
     shutdown_mode_(SHUTDOWN_CLEAN),
     wireUpFinished_(false),
     one_shot_manager_(this),
+    clock_scheduler_(this),
     runMode(config.runMode()),
     currentSimCycle(currentSimCycle),
     currentPriority(currentPriority),
@@ -296,12 +320,61 @@ Simulation_impl::Simulation_impl(
     // interthread links if we're not in the restart path
     timeVortexType = config.timeVortex();
     if ( !restart ) {
+        // Direct interthread links normally deliver through per thread
+        // pair channels that are drained by the receiving thread, so
+        // the TimeVortex does not need to be thread safe.  The mpsc
+        // TimeVortex already stages inserts from each thread without
+        // locking, so it takes them directly instead, as does any
+        // thread safe TimeVortex that is asked for by name.
         direct_interthread = config.interthread_links();
-        if ( direct_interthread && num_ranks.thread > 1 ) timeVortexType = timeVortexType + ".ts";
+        if ( direct_interthread && num_ranks.thread > 1 && timeVortexType == "sst.timevortex.mpsc" )
+            timeVortexType = timeVortexType + ".ts";
+        interthread_channels = !(timeVortexType.size() > 3 && timeVortexType.substr(timeVortexType.size() - 3) == ".ts");
     }
     else {
         // Direct interthread links not yet supported with checkpointing
-        direct_interthread = false;
+        direct_interthread   = false;
+        interthread_channels = true;
+    }
+
+    batch_dispatch       = config.batch_dispatch();
+    batch_dispatch_group = config.batch_dispatch_group();
+
+    // Lookahead rank sync lets ranks sync at different simulated
+    // times, so it can't be used with anything that needs all ranks
+    // at the same time
+    rank_sync = restart ? "skip" : config.rank_sync();
+    // Multithreaded runs always use the parallel version of skip
+    if ( rank_sync != "skip" && num_ranks.thread > 1 ) {
+        if ( my_rank.rank == 0 && my_rank.thread == 0 ) {
+            sim_output.output("WARNING: --rank-sync=%s is not supported with more than one thread, using "
+                              "--rank-sync=skip\n",
+                rank_sync.c_str());
+        }
+        rank_sync = "skip";
+    }
+    if ( rank_sync == "lookahead" && (config.canInitiateCheckpoint() || config.heartbeat_sim_period() != "") ) {
+        if ( my_rank.rank == 0 && my_rank.thread == 0 ) {
+            sim_output.output("WARNING: --rank-sync=lookahead is not supported with checkpoints or a sim-period "
+                              "heartbeat, using --rank-sync=skip\n");
+        }
+        rank_sync = "skip";
+    }
+    // Pipelined rank sync leaves events in flight between syncs
+    if ( rank_sync == "pipelined" && config.canInitiateCheckpoint() ) {
+        if ( my_rank.rank == 0 && my_rank.thread == 0 ) {
+            sim_output.output("WARNING: --rank-sync=pipelined is not supported with checkpoints, using "
+                              "--rank-sync=skip\n");
+        }
+        rank_sync = "skip";
+    }
+    // The other rank syncs do their own exchanges
+    rank_sync_shmem = config.rank_sync_shmem();
+    if ( rank_sync_shmem && rank_sync != "skip" ) {
+        if ( my_rank.rank == 0 && my_rank.thread == 0 ) {
+            sim_output.output("WARNING: --rank-sync-shmem is only supported with --rank-sync=skip, ignoring\n");
+        }
+        rank_sync_shmem = false;
     }
 
     Params p;
@@ -512,7 +585,10 @@ Simulation_impl::processGraphInfo(ConfigGraph& graph, const RankInfo& UNUSED(myR
         // Find the minimum latency across a partition
         for ( auto iter = links.begin(); iter != links.end(); ++iter ) {
             ConfigLink* clink = *iter;
-            RankInfo    rank[2];
+            // Nonlocal links go to another rank, and component[1]
+            // holds the remote rank rather than a component id
+            if ( clink->nonlocal ) continue;
+            RankInfo rank[2];
             rank[0] = comps[COMPONENT_ID_MASK(clink->component[0])]->rank;
             rank[1] = comps[COMPONENT_ID_MASK(clink->component[1])]->rank;
             // We only care about links that are on my rank, but
@@ -693,6 +769,7 @@ Simulation_impl::prepareLinks(ConfigGraph& graph, const RankInfo& myRank, SimTim
                 sim_output.fatal(CALL_INFO, 1, "Couldn't find ComponentInfo in map.");
             }
             cinfo->getLinkMap()->insertLink(clink->port[local], link);
+            syncManager->registerDirectLink(link, rank[local ^ 1]);
         }
         // If the components are not in the same thread, then the
         // SyncManager will handle things
@@ -920,6 +997,60 @@ Simulation_impl::prepare_for_run()
     header += ":  ";
 }
 
+bool
+Simulation_impl::executeBatch()
+{
+    timeVortex->popBatch(dispatch_batch);
+
+    Activity* first      = dispatch_batch.front();
+    // Check for time fault.  All activities in the batch have the
+    // same delivery time and priority, so only need to check once.
+    SimTime_t event_time = first->getDeliveryTime();
+    bool      time_fault = event_time < currentSimCycle;
+
+    currentSimCycle = event_time;
+    currentPriority = first->getPriority();
+
+    // Group the events by delivery handler, with the groups in the
+    // order their handlers first appear in the batch so the order
+    // doesn't depend on where the handlers are in memory.  Batches
+    // only contain more than one activity if they are all events.
+    size_t count = dispatch_batch.size();
+    if ( batch_dispatch_group && count > 1 ) {
+        dispatch_groups.clear();
+        dispatch_grouped.clear();
+        for ( auto* activity : dispatch_batch ) {
+            auto it = dispatch_groups.try_emplace(static_cast<Event*>(activity)->delivery_info, dispatch_groups.size())
+                          .first;
+            dispatch_grouped.emplace_back(it->second, activity);
+        }
+        if ( dispatch_groups.size() > 1 ) {
+            std::stable_sort(dispatch_grouped.begin(), dispatch_grouped.end(),
+                [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+            for ( size_t i = 0; i < count; ++i ) {
+                dispatch_batch[i] = dispatch_grouped[i].second;
+            }
+        }
+    }
+
+    for ( size_t i = 0; i < count; ++i ) {
+        current_activity = dispatch_batch[i];
+        current_activity->execute();
+
+        // If an event ended the simulation, put the rest of the batch
+        // back into the TimeVortex so they are cleaned up along with
+        // everything else
+        if ( UNLIKELY(endSim) ) {
+            for ( size_t j = i + 1; j < count; ++j ) {
+                timeVortex->insert(dispatch_batch[j]);
+            }
+            dispatch_batch.resize(i + 1);
+            break;
+        }
+    }
+    return time_fault;
+}
+
 void
 Simulation_impl::run()
 {
@@ -982,21 +1113,30 @@ Simulation_impl::run()
     bool time_fault = false;
     while ( LIKELY(!endSim && !time_fault) ) {
 
-        current_activity     = timeVortex->pop();
-        // Check for time fault
-        SimTime_t event_time = current_activity->getDeliveryTime();
+        if ( UNLIKELY(batch_dispatch) ) {
+            time_fault = executeBatch();
+#if SST_PERIODIC_PRINT
+            periodicCounter += dispatch_batch.size();
+#endif
+            dispatch_batch.clear();
+        }
+        else {
+            current_activity     = timeVortex->pop();
+            // Check for time fault
+            SimTime_t event_time = current_activity->getDeliveryTime();
 
-        time_fault = event_time < currentSimCycle;
+            time_fault = event_time < currentSimCycle;
 
-        currentSimCycle = event_time;
+            currentSimCycle = event_time;
 
-        currentPriority = current_activity->getPriority();
+            currentPriority = current_activity->getPriority();
 
-        current_activity->execute();
+            current_activity->execute();
 
 #if SST_PERIODIC_PRINT
-        periodicCounter++;
+            periodicCounter++;
 #endif
+        }
 
         // If logic is strange, but we only want one potential branch
         // in the main loop.  If one of the unlikely cases is hit, we
@@ -1317,6 +1457,55 @@ Simulation_impl::reregisterClock(TimeConverter* tc, Clock::HandlerBase* handler,
     return clockMap[mapKey]->getNextCycle();
 }
 
+void
+Simulation_impl::sleepClock(
+    TimeConverter& tc, Clock::HandlerBase* handler, int priority, Cycle_t wake_cycle, Event::HandlerBase* wake_handler)
+{
+    clockMap_t::key_type mapKey = std::make_pair(tc.getFactor(), priority);
+    if ( clockMap.find(mapKey) == clockMap.end() ) {
+        Output out("Simulation: @R:@t:", 0, 0, Output::STDERR);
+        out.fatal(
+            CALL_INFO, 1, "Tried to sleep a clock handler on a clock that was not previously registered, exiting...\n");
+    }
+    clockMap[mapKey]->sleepHandler(handler, wake_cycle, wake_handler);
+}
+
+void
+Simulation_impl::wakeClock(TimeConverter& tc, Clock::HandlerBase* handler, int priority)
+{
+    clockMap_t::key_type mapKey = std::make_pair(tc.getFactor(), priority);
+    if ( clockMap.find(mapKey) != clockMap.end() ) {
+        clockMap[mapKey]->wakeHandler(handler);
+    }
+}
+
+void
+Simulation_impl::joinClockedArray(ClockedArrayMemberBase* member)
+{
+    clockedArrayMap_t::key_type arrayKey = std::make_pair(member->factor, std::type_index(typeid(*member)));
+    ClockedArrayBase*&          array    = clockedArrayMap[arrayKey];
+    if ( nullptr == array ) array = member->createArray();
+    array->add(member);
+
+    // The array takes itself off the clock when it empties, so it may
+    // need to be registered again
+    clockMap_t::key_type mapKey = std::make_pair(member->factor, CLOCKPRIORITY);
+    auto                 it     = clockMap.find(mapKey);
+    if ( it == clockMap.end() || !it->second->isHandlerRegistered(array) ) {
+        registerClock(member->factor, array, CLOCKPRIORITY);
+    }
+}
+
+void
+Simulation_impl::leaveClockedArray(ClockedArrayMemberBase* member)
+{
+    clockedArrayMap_t::key_type arrayKey = std::make_pair(member->factor, std::type_index(typeid(*member)));
+    auto                        it       = clockedArrayMap.find(arrayKey);
+    if ( it != clockedArrayMap.end() ) {
+        it->second->remove(member);
+    }
+}
+
 Cycle_t
 Simulation_impl::getNextClockCycle(TimeConverter& tc, int priority)
 {
@@ -1381,6 +1570,14 @@ Simulation_impl::insertActivity(SimTime_t time, Activity* ev)
     timeVortex->insert(ev);
 }
 
+Core::LocalEventScheduler*
+Simulation_impl::createLocalEventScheduler()
+{
+    auto* scheduler = new Core::LocalEventScheduler(this);
+    local_event_schedulers_.push_back(scheduler);
+    return scheduler;
+}
+
 uint64_t
 Simulation_impl::getTimeVortexMaxDepth() const
 {
@@ -1837,6 +2034,9 @@ Simulation_impl::checkpoint(const std::string& checkpoint_filename)
     // First we need to get the TimeVortexContents and sort them
     tv_sort_.data.clear();
     timeVortex->getContents(tv_sort_.data);
+    for ( auto* x : local_event_schedulers_ ) {
+        x->getContents(tv_sort_.data);
+    }
     tv_sort_.sortData();
 
     size_t            size = ser.size();
@@ -2270,6 +2470,7 @@ Util::BasicPerfTracker Simulation_impl::basicPerf;
 /* Define statics (Simulation) */
 std::unordered_map<std::thread::id, Simulation_impl*> Simulation_impl::instanceMap;
 std::vector<Simulation_impl*>                         Simulation_impl::instanceVec_;
+thread_local Simulation_impl*                         Simulation_impl::thread_instance_ = nullptr;
 std::atomic<int>                                      Simulation_impl::untimed_msg_count;
 Exit*                                                 Simulation_impl::m_exit;
 
@@ -15,8 +15,11 @@
 #define SST_CORE_SIMULATION_IMPL_H
 
 #include "sst/core/clock.h"
+#include "sst/core/clockedArray.h"
 #include "sst/core/componentInfo.h"
 #include "sst/core/exit.h"
+#include "sst/core/impl/clockScheduler.h"
+#include "sst/core/impl/localEventScheduler.h"
 #include "sst/core/impl/oneshotManager.h"
 #include "sst/core/output.h"
 #include "sst/core/profile/profiletool.h"
@@ -35,6 +38,7 @@
 #include <set>
 #include <signal.h>
 #include <thread>
+#include <typeindex>
 #include <unordered_map>
 #include <vector>
 
@@ -171,14 +175,25 @@ public:
     /******** End Public API from Simulation ********/
 
     using clockMap_t = std::map<std::pair<SimTime_t, int>, Clock*>; /*!< Map of times to clocks */
+    /*! Map of clock factor and member type to ClockedArrays */
+    using clockedArrayMap_t = std::map<std::pair<SimTime_t, std::type_index>, ClockedArrayBase*>;
     // using oneShotMap_t = std::map<int, OneShot*>; /*!< Map of priorities to OneShots */
 
     ~Simulation_impl();
 
     /*********  Static Core-only Functions *********/
 
-    /** Return a pointer to the singleton instance of the Simulation */
-    static Simulation_impl* getSimulation() { return instanceMap.at(std::this_thread::get_id()); }
+    /** Return a pointer to the singleton instance of the Simulation.
+     * Threads that created a Simulation_impl get it from a
+     * thread-local pointer; any other thread falls back to a lookup
+     * in instanceMap.
+     */
+    static Simulation_impl* getSimulation()
+    {
+        Simulation_impl* sim = thread_instance_;
+        if ( nullptr != sim ) return sim;
+        return instanceMap.at(std::this_thread::get_id());
+    }
 
     /** Return the TimeLord associated with this Simulation */
     static TimeLord* getTimeLord() { return &timeLord; }
@@ -212,6 +227,9 @@ public:
     /** Return the exit event */
     Exit* getExit() const { return m_exit; }
 
+    /** Return the cycle set with --stop-at, or 0 if there is none */
+    SimTime_t getStopAtCycle() const { return stop_at_; }
+
     /** Processes the ConfigGraph to pull out any need information
      * about relationships among the threads
      */
@@ -365,6 +383,25 @@ public:
     Cycle_t reregisterClock(TimeConverter* tc, Clock::HandlerBase* handler, int priority);
     Cycle_t reregisterClock(TimeConverter& tc, Clock::HandlerBase* handler, int priority);
 
+    /** Put a clock handler to sleep until wake_cycle or, if
+     * wake_handler is not nullptr, the next event delivered to
+     * wake_handler.  See Clock::sleepHandler().
+     */
+    void sleepClock(TimeConverter& tc, Clock::HandlerBase* handler, int priority, Cycle_t wake_cycle,
+        Event::HandlerBase* wake_handler = nullptr);
+
+    /** Wake a sleeping clock handler so it fires on the next cycle */
+    void wakeClock(TimeConverter& tc, Clock::HandlerBase* handler, int priority);
+
+    /** Add the instance held by member to the ClockedArray for its
+     * type at member->factor, registering the array with the clock if
+     * needed.
+     */
+    void joinClockedArray(ClockedArrayMemberBase* member);
+
+    /** Remove the instance held by member from its ClockedArray */
+    void leaveClockedArray(ClockedArrayMemberBase* member);
+
     /** Returns the next Cycle that the TimeConverter would fire. */
     Cycle_t getNextClockCycle(TimeConverter* tc, int priority = CLOCKPRIORITY);
     Cycle_t getNextClockCycle(TimeConverter& tc, int priority = CLOCKPRIORITY);
@@ -457,11 +494,26 @@ public:
     static Core::ThreadSafe::Spinlock cross_thread_lock;
     static std::map<LinkId_t, Link*>  cross_thread_links;
     bool                              direct_interthread;
+    // True if direct interthread links send through the thread
+    // sync's channels rather than into the remote TimeVortex
+    bool                              interthread_channels;
+
+    // RankSync to use between ranks (--rank-sync)
+    std::string rank_sync;
+    // Exchange events with ranks on the same node through shared
+    // memory (--rank-sync-shmem)
+    bool        rank_sync_shmem;
 
     Component* createComponent(ComponentId_t id, const std::string& name, Params& params);
 
     TimeVortex* getTimeVortex() const { return timeVortex; }
 
+    /**
+       Creates a LocalEventScheduler for a component on this thread.
+       The scheduler is owned by the Simulation_impl.
+     */
+    Core::LocalEventScheduler* createLocalEventScheduler();
+
     /** Emergency Shutdown
      * Called when a fatal event has occurred
      */
@@ -491,6 +543,15 @@ public:
     std::string             timeVortexType;  // Required for checkpoint
     TimeConverter           threadMinPartTC; // Unused...?
     Activity*               current_activity;
+    // Batched dispatch support (see Config::batch_dispatch)
+    bool                    batch_dispatch       = false;
+    bool                    batch_dispatch_group = false;
+    std::vector<Activity*>  dispatch_batch;
+
+    // Scratch space used to group a batch by delivery handler
+    std::unordered_map<uintptr_t, size_t>     dispatch_groups;
+    std::vector<std::pair<size_t, Activity*>> dispatch_grouped;
+
     static SimTime_t        minPart;
     static TimeConverter    minPartTC;
     std::vector<SimTime_t>  interThreadLatencies;
@@ -498,6 +559,7 @@ public:
     SyncManager*            syncManager;
     ComponentInfoMap        compInfoMap;
     clockMap_t              clockMap;
+    clockedArrayMap_t       clockedArrayMap;
     static Exit*            m_exit;
     SimulatorHeartbeat*     m_heartbeat = nullptr;
     CheckpointAction*       checkpoint_action_;
@@ -520,6 +582,13 @@ public:
     // OneShotManager
     Core::OneShotManager one_shot_manager_;
 
+    // Schedules the ticks for all the clocks in clockMap
+    Core::ClockScheduler clock_scheduler_;
+
+    // Schedulers for the self links of components that called
+    // enableLocalEventScheduler()
+    std::vector<Core::LocalEventScheduler*> local_event_schedulers_;
+
     /**
        vector to hold offsets of component blobs in checkpoint files
      */
@@ -655,6 +724,8 @@ public:
 
     static std::unordered_map<std::thread::id, Simulation_impl*> instanceMap;
     static std::vector<Simulation_impl*>                         instanceVec_;
+    /** Simulation_impl created by the calling thread */
+    static thread_local Simulation_impl*                         thread_instance_;
 
     /******** Checkpoint/restart tracking data structures ***********/
     std::map<std::pair<int, uintptr_t>, Link*> link_restart_tracking;
@@ -679,6 +750,15 @@ private:
      * that is in the TImeVortex of the Simulation
      */
     SimTime_t getNextActivityTime() const;
+
+    /**
+     * Pops the next batch of activities from the TimeVortex into
+     * dispatch_batch and executes them.  Used by run() when batched
+     * dispatch is enabled.
+     *
+     * @return true if a time fault was detected
+     */
+    bool executeBatch();
 };
 
 // Function to allow for easy serialization of threads while debugging
@@ -29,6 +29,7 @@ using Time_t        = double;
 #define PRI_SIMTIME PRIu64
 
 static constexpr StatisticId_t STATALL_ID = std::numeric_limits<StatisticId_t>::max();
+static constexpr Cycle_t       MAX_CYCLE  = std::numeric_limits<Cycle_t>::max();
 
 #define MAX_SIMTIME_T 0xFFFFFFFFFFFFFFFFl
 
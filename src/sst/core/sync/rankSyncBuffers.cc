@@ -0,0 +1,245 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/sync/rankSyncBuffers.h"
+
+#include "sst/core/sync/syncQueue.h"
+
+namespace SST {
+
+namespace {
+
+// Smallest size used for a message
+constexpr uint32_t MIN_MESSAGE_SIZE = 256;
+
+// Initial size of the receive buffers
+constexpr uint32_t INITIAL_BUFFER_SIZE = 4096;
+
+// Returns the smallest power of two multiple of minimum that is at
+// least size
+uint32_t
+roundUpSize(uint32_t size, uint32_t minimum)
+{
+    uint32_t ret = minimum;
+    while ( ret < size )
+        ret *= 2;
+    return ret;
+}
+
+// The RankSyncs are not deleted before MPI is finalized, but make
+// sure requests are not freed after it is
+bool
+mpiFinalized()
+{
+    int finalized = 0;
+#ifdef SST_CONFIG_HAVE_MPI
+    MPI_Finalized(&finalized);
+#endif
+    return finalized != 0;
+}
+
+} // namespace
+
+RankSyncSendBuffer::~RankSyncSendBuffer()
+{
+    freeRequests();
+}
+
+void
+RankSyncSendBuffer::init(int rank, int tag)
+{
+    rank_        = rank;
+    tag_         = tag;
+    remote_size_ = INITIAL_BUFFER_SIZE;
+}
+
+void
+RankSyncSendBuffer::freeRequests()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    if ( !requests_.empty() && !mpiFinalized() ) {
+        for ( auto& req : requests_ ) {
+            if ( req != MPI_REQUEST_NULL ) MPI_Request_free(&req);
+        }
+    }
+    requests_.clear();
+#endif
+}
+
+void
+RankSyncSendBuffer::start(char* UNUSED_WO_MPI(buffer))
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    RankSyncQueue::Header* hdr  = reinterpret_cast<RankSyncQueue::Header*>(buffer);
+    uint32_t               size = hdr->buffer_size;
+
+    // The persistent requests are tied to the buffer
+    if ( buffer != buffer_ ) {
+        freeRequests();
+        buffer_ = buffer;
+    }
+
+    if ( size > remote_size_ ) {
+        // Not big enough.  Send the header to tell the remote side
+        // to get a larger buffer, then the message on the next tag
+        remote_size_ = roundUpSize(size, 2 * remote_size_);
+        resizes_++;
+        misses_++;
+        last_size_ = size;
+
+        hdr->mode      = 1;
+        hdr->recv_size = remote_size_;
+        MPI_Isend(buffer, sizeof(RankSyncQueue::Header), MPI_BYTE, rank_, tag_, MPI_COMM_WORLD, &miss_reqs_[0]);
+        MPI_Isend(buffer, size, MPI_BYTE, rank_, tag_ + 1, MPI_COMM_WORLD, &miss_reqs_[1]);
+        miss_count_ = 2;
+        return;
+    }
+
+    // Predict the next size by assuming it changes as much as it did
+    // since the last message, and grow the remote buffer now if it
+    // won't fit
+    uint32_t predicted = size > last_size_ ? size + (size - last_size_) : size;
+    if ( predicted > remote_size_ ) {
+        remote_size_ = roundUpSize(predicted, 2 * remote_size_);
+        resizes_++;
+    }
+    last_size_ = size;
+
+    hdr->mode      = 0;
+    hdr->recv_size = remote_size_;
+
+    // Send with the smallest size class that holds the message.  It
+    // fits in the buffer because RankSyncQueue allocates powers of
+    // two, and in the remote buffer because remote_size_ is a power
+    // of two.
+    uint32_t msg_size = roundUpSize(size, MIN_MESSAGE_SIZE);
+    int      index    = 0;
+    for ( uint32_t s = MIN_MESSAGE_SIZE; s < msg_size; s *= 2 )
+        index++;
+
+    if ( requests_.size() <= static_cast<size_t>(index) ) requests_.resize(index + 1, MPI_REQUEST_NULL);
+    if ( requests_[index] == MPI_REQUEST_NULL ) {
+        MPI_Send_init(buffer_, msg_size, MPI_BYTE, rank_, tag_, MPI_COMM_WORLD, &requests_[index]);
+    }
+    MPI_Start(&requests_[index]);
+    active_ = index;
+#endif
+}
+
+void
+RankSyncSendBuffer::wait()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    if ( active_ >= 0 ) {
+        MPI_Wait(&requests_[active_], MPI_STATUS_IGNORE);
+        active_ = -1;
+    }
+    if ( miss_count_ > 0 ) {
+        MPI_Waitall(miss_count_, miss_reqs_, MPI_STATUSES_IGNORE);
+        miss_count_ = 0;
+    }
+#endif
+}
+
+RankSyncRecvBuffer::~RankSyncRecvBuffer()
+{
+    freeRequest();
+    delete[] buffer_;
+}
+
+void
+RankSyncRecvBuffer::init(int rank, int tag)
+{
+    rank_   = rank;
+    tag_    = tag;
+    buffer_ = new char[INITIAL_BUFFER_SIZE];
+    size_   = INITIAL_BUFFER_SIZE;
+}
+
+void
+RankSyncRecvBuffer::freeRequest()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    if ( request_ != MPI_REQUEST_NULL && !mpiFinalized() ) MPI_Request_free(&request_);
+    request_ = MPI_REQUEST_NULL;
+#endif
+}
+
+void
+RankSyncRecvBuffer::resize(uint32_t size)
+{
+    freeRequest();
+    delete[] buffer_;
+    buffer_ = new char[size];
+    size_   = size;
+    resizes_++;
+}
+
+void
+RankSyncRecvBuffer::reserve(uint32_t size)
+{
+    if ( size > size_ ) resize(roundUpSize(size, 2 * size_));
+}
+
+void
+RankSyncRecvBuffer::start()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    // Grow the buffer if the sender asked for it in the last message
+    if ( next_size_ > size_ ) resize(next_size_);
+
+    if ( request_ == MPI_REQUEST_NULL ) {
+        MPI_Recv_init(buffer_, size_, MPI_BYTE, rank_, tag_, MPI_COMM_WORLD, &request_);
+    }
+    MPI_Start(&request_);
+#endif
+}
+
+bool
+RankSyncRecvBuffer::test()
+{
+    int flag = 1;
+#ifdef SST_CONFIG_HAVE_MPI
+    MPI_Test(&request_, &flag, MPI_STATUS_IGNORE);
+#endif
+    return flag != 0;
+}
+
+void
+RankSyncRecvBuffer::wait()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    MPI_Wait(&request_, MPI_STATUS_IGNORE);
+#endif
+}
+
+char*
+RankSyncRecvBuffer::complete()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    RankSyncQueue::Header* hdr       = reinterpret_cast<RankSyncQueue::Header*>(buffer_);
+    uint32_t               recv_size = hdr->recv_size;
+
+    if ( hdr->mode == 1 ) {
+        // The message didn't fit, so only the header was sent
+        if ( recv_size > size_ ) resize(recv_size);
+        MPI_Recv(buffer_, size_, MPI_BYTE, rank_, tag_ + 1, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+    }
+    else {
+        next_size_ = recv_size;
+    }
+#endif
+    return buffer_;
+}
+
+} // namespace SST
@@ -0,0 +1,145 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_SYNC_RANKSYNCBUFFERS_H
+#define SST_CORE_SYNC_RANKSYNCBUFFERS_H
+
+#include "sst/core/sst_mpi.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace SST {
+
+/**
+   Send side of the RankSync exchanges with one remote rank.
+
+   Buffers come from RankSyncQueue::getData() and are sent with
+   persistent requests (MPI_Send_init).  Each message is sent with
+   the smallest power of two size that holds it, with one persistent
+   request per size that has been used, so requests are only created
+   again when the RankSyncQueue reallocates its buffer.
+
+   The size of the receive buffer on the remote rank is tracked here.
+   If a message doesn't fit, the header is sent first to tell the
+   remote rank to grow its buffer, and the message follows on tag + 1.
+   To keep this off the common path, the size of the next message is
+   predicted from the last two, and if it won't fit the remote rank is
+   told to grow its buffer in the header of the current message.
+   Buffers grow by powers of two.
+ */
+class RankSyncSendBuffer
+{
+public:
+    RankSyncSendBuffer() = default;
+    ~RankSyncSendBuffer();
+
+    RankSyncSendBuffer(const RankSyncSendBuffer&)            = delete;
+    RankSyncSendBuffer& operator=(const RankSyncSendBuffer&) = delete;
+
+    /** Set the rank and tag to send to */
+    void init(int rank, int tag);
+
+    /** Start sending buffer, which must come from
+     * RankSyncQueue::getData().  It can't be changed until wait()
+     * returns. */
+    void start(char* buffer);
+
+    /** Wait for the sends started by start() */
+    void wait();
+
+    /** Size of the receive buffer on the remote rank */
+    uint32_t getRemoteSize() const { return remote_size_; }
+    /** Number of times the remote receive buffer was grown */
+    uint32_t getResizeCount() const { return resizes_; }
+    /** Number of times a message didn't fit and needed a second send */
+    uint32_t getMissCount() const { return misses_; }
+
+private:
+    void freeRequests();
+
+    int      rank_        = 0;
+    int      tag_         = 0;
+    char*    buffer_      = nullptr;
+    uint32_t remote_size_ = 0;
+    uint32_t last_size_   = 0;
+    uint32_t resizes_     = 0;
+    uint32_t misses_      = 0;
+
+#ifdef SST_CONFIG_HAVE_MPI
+    // Persistent requests on buffer_, indexed by size class
+    std::vector<MPI_Request> requests_;
+    int                      active_ = -1;
+
+    // Sends used when a message doesn't fit
+    MPI_Request miss_reqs_[2];
+    int         miss_count_ = 0;
+#endif
+};
+
+/**
+   Receive side of the RankSync exchanges with one remote rank.
+
+   Receives are done with a persistent request (MPI_Recv_init) on a
+   buffer that only grows when the sending RankSyncSendBuffer says to.
+ */
+class RankSyncRecvBuffer
+{
+public:
+    RankSyncRecvBuffer() = default;
+    ~RankSyncRecvBuffer();
+
+    RankSyncRecvBuffer(const RankSyncRecvBuffer&)            = delete;
+    RankSyncRecvBuffer& operator=(const RankSyncRecvBuffer&) = delete;
+
+    /** Set the rank and tag to receive from */
+    void init(int rank, int tag);
+
+    /** Start the receive */
+    void start();
+    /** Returns true if the receive started by start() has completed */
+    bool test();
+    /** Wait for the receive started by start() */
+    void wait();
+
+    /** Finish a completed receive.  If the message didn't fit, this
+     * grows the buffer and receives it.  Returns the buffer holding
+     * the message. */
+    char* complete();
+
+    /** Grow the buffer to hold at least size bytes, for receives not
+     * done with start() */
+    void reserve(uint32_t size);
+
+    char*    getBuffer() { return buffer_; }
+    uint32_t getSize() const { return size_; }
+    /** Number of times the buffer was grown */
+    uint32_t getResizeCount() const { return resizes_; }
+
+private:
+    void resize(uint32_t size);
+    void freeRequest();
+
+    int      rank_      = 0;
+    int      tag_       = 0;
+    char*    buffer_    = nullptr;
+    uint32_t size_      = 0;
+    uint32_t next_size_ = 0;
+    uint32_t resizes_   = 0;
+
+#ifdef SST_CONFIG_HAVE_MPI
+    MPI_Request request_ = MPI_REQUEST_NULL;
+#endif
+};
+
+} // namespace SST
+
+#endif // SST_CORE_SYNC_RANKSYNCBUFFERS_H
@@ -0,0 +1,315 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/sync/rankSyncLookahead.h"
+
+#include "sst/core/event.h"
+#include "sst/core/exit.h"
+#include "sst/core/link.h"
+#include "sst/core/output.h"
+#include "sst/core/profile.h"
+#include "sst/core/serialization/serializer.h"
+#include "sst/core/simulation_impl.h"
+#include "sst/core/sst_mpi.h"
+#include "sst/core/sync/syncQueue.h"
+
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+namespace SST {
+
+void
+RankSyncLookahead::Status::merge(const Status& other)
+{
+    active   = std::max(active, other.active);
+    end_time = std::max(end_time, other.end_time);
+    // Each signal is combined with max, same as the other RankSyncs
+    uint32_t combined = 0;
+    for ( int i = 0; i < 3; ++i ) {
+        uint32_t shift = 8 * i;
+        combined |= std::max((signals >> shift) & 0xff, (other.signals >> shift) & 0xff) << shift;
+    }
+    signals = combined;
+}
+
+RankSyncLookahead::RankSyncLookahead(RankInfo num_ranks) :
+    RankSyncSerialSkip(num_ranks)
+{}
+
+RankSyncLookahead::~RankSyncLookahead() {}
+
+ActivityQueue*
+RankSyncLookahead::registerLink(const RankInfo& to_rank, const RankInfo& from_rank, const std::string& name, Link* link)
+{
+    ActivityQueue* queue = RankSyncSerialSkip::registerLink(to_rank, from_rank, name, link);
+
+    std::lock_guard<Core::ThreadSafe::Spinlock> slock(lock);
+    Peer& peer     = peers[to_rank.rank];
+    peer.lookahead = std::min(peer.lookahead, getSendLatency(link));
+    return queue;
+}
+
+void
+RankSyncLookahead::finalizeLinkConfigurations()
+{
+    RankSyncSerialSkip::finalizeLinkConfigurations();
+
+    stop_at_       = Simulation_impl::getSimulation()->getStopAtCycle();
+    status_rounds_ = computeStatusRounds();
+    if ( status_rounds_ == 0 ) {
+        enabled_ = false;
+        if ( Simulation_impl::getSimulation()->getRank().rank == 0 )
+            Output::getDefaultObject().verbose(CALL_INFO, 1, 0,
+                "RankSyncLookahead: ranks are not all connected by links, using the global sync instead\n");
+        return;
+    }
+
+    next_sync_ = MAX_SIMTIME_T;
+    for ( auto& [rank, peer] : peers ) {
+        next_sync_ = std::min(next_sync_, peer.promise);
+    }
+    if ( stop_at_ != 0 && next_sync_ > stop_at_ ) next_sync_ = stop_at_;
+}
+
+uint32_t
+RankSyncLookahead::computeStatusRounds()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    // Every rank gets the list of neighbors and lookaheads of every
+    // other rank.  This is only done once, so it's kept simple.
+    std::vector<uint64_t> mine;
+    for ( auto& [rank, peer] : peers ) {
+        mine.push_back(rank);
+        mine.push_back(peer.lookahead);
+    }
+
+    int              num_ranks = num_ranks_.rank;
+    int              my_count  = mine.size();
+    std::vector<int> counts(num_ranks);
+    MPI_Allgather(&my_count, 1, MPI_INT, counts.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+    std::vector<int> displs(num_ranks, 0);
+    for ( int i = 1; i < num_ranks; ++i ) {
+        displs[i] = displs[i - 1] + counts[i - 1];
+    }
+    std::vector<uint64_t> all(displs[num_ranks - 1] + counts[num_ranks - 1]);
+    MPI_Allgatherv(mine.data(), my_count, MPI_UINT64_T, all.data(), counts.data(), displs.data(), MPI_UINT64_T,
+        MPI_COMM_WORLD);
+
+    // Promises for the first round are the lookahead of each
+    // neighbor's links to this rank
+    int my_rank = Simulation_impl::getSimulation()->getRank().rank;
+    for ( int i = 0; i < num_ranks; ++i ) {
+        for ( int j = displs[i]; j < displs[i] + counts[i]; j += 2 ) {
+            if ( all[j] == static_cast<uint64_t>(my_rank) ) peers[i].promise = all[j + 1];
+        }
+    }
+
+    // Distance from this rank to the farthest rank
+    std::vector<uint32_t> distance(num_ranks, UINT32_MAX);
+    std::deque<int>       to_visit;
+    distance[my_rank] = 0;
+    to_visit.push_back(my_rank);
+    uint32_t farthest = 0;
+    int      reached  = 1;
+    while ( !to_visit.empty() ) {
+        int current = to_visit.front();
+        to_visit.pop_front();
+        for ( int j = displs[current]; j < displs[current] + counts[current]; j += 2 ) {
+            int next = all[j];
+            if ( distance[next] != UINT32_MAX ) continue;
+            distance[next] = distance[current] + 1;
+            farthest       = std::max(farthest, distance[next]);
+            reached++;
+            to_visit.push_back(next);
+        }
+    }
+
+    // The graph is the same on every rank, so they all agree on
+    // whether it's connected
+    if ( reached != num_ranks ) return 0;
+
+    uint32_t diameter;
+    MPI_Allreduce(&farthest, &diameter, 1, MPI_UINT32_T, MPI_MAX, MPI_COMM_WORLD);
+    return diameter;
+#else
+    return 0;
+#endif
+}
+
+void
+RankSyncLookahead::execute(int thread)
+{
+    if ( !enabled_ ) {
+        RankSyncSerialSkip::execute(thread);
+        return;
+    }
+    if ( thread == 0 ) {
+        exchange();
+    }
+}
+
+SimTime_t
+RankSyncLookahead::getNextSyncTime()
+{
+    if ( !enabled_ ) return RankSyncSerialSkip::getNextSyncTime();
+    return next_sync_;
+}
+
+void
+RankSyncLookahead::setSignals(int end, int usr, int alrm)
+{
+    if ( !enabled_ ) {
+        RankSyncSerialSkip::setSignals(end, usr, alrm);
+        return;
+    }
+    // Hold on to the signals until they can be added to the status
+    pending_signals_[0] = std::max(pending_signals_[0], end);
+    pending_signals_[1] = std::max(pending_signals_[1], usr);
+    pending_signals_[2] = std::max(pending_signals_[2], alrm);
+}
+
+bool
+RankSyncLookahead::getSignals(int& end, int& usr, int& alrm)
+{
+    if ( !enabled_ ) return RankSyncSerialSkip::getSignals(end, usr, alrm);
+    end  = signals_[0];
+    usr  = signals_[1];
+    alrm = signals_[2];
+    return end || usr || alrm;
+}
+
+void
+RankSyncLookahead::checkExit(Exit* exit)
+{
+    if ( !enabled_ ) {
+        RankSyncSerialSkip::checkExit(exit);
+        return;
+    }
+    exit->setGlobalCount(global_active_);
+    if ( global_active_ == 0 ) exit->setEndTime(global_end_time_);
+}
+
+void
+RankSyncLookahead::exchange()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    Simulation_impl* sim = Simulation_impl::getSimulation();
+    SimTime_t        now = sim->getCurrentSimCycle();
+
+    // If the simulation stops now, this is the last message to each
+    // neighbor.  They no longer wait on this rank after getting it.
+    bool last_round = stop_at_ != 0 && now >= stop_at_;
+
+    // Start a new status at the beginning of each set of rounds
+    if ( status_round_ == 0 ) {
+        Exit* exit       = sim->getExit();
+        status_          = Status();
+        status_.active   = exit->getRefCount() > 0 ? 1 : 0;
+        status_.end_time = exit->getEndTime();
+        for ( int i = 0; i < 3; ++i ) {
+            status_.signals |= (static_cast<uint32_t>(pending_signals_[i]) & 0xff) << (8 * i);
+            pending_signals_[i] = 0;
+        }
+    }
+
+    for ( auto& [rank, peer] : peers ) {
+        if ( peer.done ) continue;
+        comm_pair& comm = comm_map[rank];
+
+        auto  serialStart = SST::Core::Profile::now();
+        char* send_buffer = comm.squeue->getData();
+        serializeTime += SST::Core::Profile::getElapsed(serialStart);
+
+        RankSyncQueue::Header* hdr = reinterpret_cast<RankSyncQueue::Header*>(send_buffer);
+        hdr->time                  = last_round ? MAX_SIMTIME_T : now + peer.lookahead;
+        hdr->status                = status_.active | (last_round ? 2 : 0);
+        hdr->signals               = status_.signals;
+        hdr->end_time              = status_.end_time;
+
+        comm.send_buffer.start(send_buffer);
+        comm.recv_buffer.start();
+    }
+
+    auto waitStart = SST::Core::Profile::now();
+    for ( auto& [rank, peer] : peers ) {
+        if ( !peer.done ) comm_map[rank].recv_buffer.wait();
+    }
+    mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+
+    for ( auto& [rank, peer] : peers ) {
+        if ( peer.done ) continue;
+        comm_pair& comm   = comm_map[rank];
+        char*      buffer = comm.recv_buffer.complete();
+
+        RankSyncQueue::Header* hdr  = reinterpret_cast<RankSyncQueue::Header*>(buffer);
+        unsigned int           size = hdr->buffer_size;
+
+        peer.promise = hdr->time;
+        peer.done    = (hdr->status & 2) != 0;
+
+        Status status;
+        status.active   = hdr->status & 1;
+        status.signals  = hdr->signals;
+        status.end_time = hdr->end_time;
+        status_.merge(status);
+
+        auto deserialStart = SST::Core::Profile::now();
+
+        SST::Core::Serialization::serializer ser;
+        ser.start_unpacking(&buffer[sizeof(RankSyncQueue::Header)], size - sizeof(RankSyncQueue::Header));
+
+        std::vector<Activity*> activities;
+        RankSyncQueue::serializeEvents(ser, activities);
+
+        deserializeTime += SST::Core::Profile::getElapsed(deserialStart);
+
+        sendEvents_sync(activities);
+    }
+
+    waitStart = SST::Core::Profile::now();
+    for ( auto& [rank, comm] : comm_map ) {
+        comm.send_buffer.wait();
+    }
+    mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+
+    for ( auto& [rank, comm] : comm_map ) {
+        comm.squeue->clear();
+    }
+
+    // After status_rounds_ rounds, the status has been merged with
+    // the status from every rank, and every rank is in the same round
+    signals_[0] = signals_[1] = signals_[2] = 0;
+    if ( ++status_round_ == status_rounds_ ) {
+        status_round_    = 0;
+        global_active_   = status_.active;
+        global_end_time_ = status_.end_time;
+        for ( int i = 0; i < 3; ++i ) {
+            signals_[i] = (status_.signals >> (8 * i)) & 0xff;
+        }
+    }
+
+    // Next sync is at the earliest time a neighbor could still
+    // deliver an event
+    next_sync_ = MAX_SIMTIME_T;
+    if ( last_round ) return;
+    for ( auto& [rank, peer] : peers ) {
+        if ( !peer.done ) next_sync_ = std::min(next_sync_, peer.promise);
+    }
+    if ( stop_at_ != 0 && next_sync_ > stop_at_ ) next_sync_ = stop_at_;
+#endif
+}
+
+} // namespace SST
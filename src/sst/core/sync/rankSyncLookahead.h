@@ -0,0 +1,126 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_SYNC_RANKSYNCLOOKAHEAD_H
+#define SST_CORE_SYNC_RANKSYNCLOOKAHEAD_H
+
+#include "sst/core/sst_types.h"
+#include "sst/core/sync/rankSyncSerialSkip.h"
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+namespace SST {
+
+class Exit;
+
+/**
+   RankSync that uses a separate lookahead for each neighboring rank
+   (selected with --rank-sync=lookahead).
+
+   Instead of every rank syncing at the same times, each rank only
+   exchanges with the ranks it has links to.  Every exchange is a
+   round in which each rank sends one message to each neighbor,
+   carrying the events for that neighbor and a promise: the earliest
+   delivery time of any event it will send the neighbor in later
+   rounds.  A message with no events is a null message.  The promise
+   is the time of the sync plus the minimum latency of the links to
+   the neighbor, and a rank's next sync is the earliest promise it
+   holds, so one short latency link only slows down the ranks it
+   connects.
+
+   There are no collectives in steady state.  The Exit reference
+   count, end time and signals are combined by passing them along
+   with the promises.  This takes as many rounds as the longest path
+   between two ranks in the link graph, and the result is applied on
+   all ranks in the same round.
+
+   The link graph is computed when links are finalized.  If it's not
+   connected, this falls back to the RankSyncSerialSkip behavior.
+ */
+class RankSyncLookahead : public RankSyncSerialSkip
+{
+public:
+    explicit RankSyncLookahead(RankInfo num_ranks);
+    virtual ~RankSyncLookahead();
+
+    /** Register a Link which this Sync Object is responsible for */
+    ActivityQueue* registerLink(
+        const RankInfo& to_rank, const RankInfo& from_rank, const std::string& name, Link* link) override;
+    void execute(int thread) override;
+
+    /** Finish link configuration */
+    void finalizeLinkConfigurations() override;
+
+    /** Set signals to exchange during sync */
+    void setSignals(int end, int usr, int alrm) override;
+    /** Return exchanged signals after sync */
+    bool getSignals(int& end, int& usr, int& alrm) override;
+
+    /** Check whether the simulation should end */
+    void checkExit(Exit* exit) override;
+
+    SimTime_t getNextSyncTime() override;
+
+private:
+    // Status passed between ranks to combine Exit and signal state
+    struct Status
+    {
+        uint32_t  active   = 0;
+        uint32_t  signals  = 0; // sig_end, sig_usr, sig_alrm in bytes 0-2
+        SimTime_t end_time = 0;
+
+        void merge(const Status& other);
+    };
+
+    struct Peer
+    {
+        // Minimum latency of the links to the peer
+        SimTime_t lookahead = MAX_SIMTIME_T;
+        // Earliest delivery time of events the peer can still send
+        SimTime_t promise   = 0;
+        // Set when the peer has sent its last message
+        bool      done      = false;
+    };
+
+    // Does one round of the exchange
+    void exchange();
+
+    // Computes how many rounds it takes for status to reach every
+    // rank.  Returns 0 if the link graph is not connected.
+    uint32_t computeStatusRounds();
+
+    std::map<int, Peer> peers;
+
+    bool      enabled_   = true;
+    SimTime_t next_sync_ = 0;
+    SimTime_t stop_at_   = 0;
+
+    // Rounds needed to combine status and the position in the
+    // current set of rounds
+    uint32_t status_rounds_ = 1;
+    uint32_t status_round_  = 0;
+    Status   status_;
+
+    // Signals seen locally since the status was last started, and
+    // the combined ones returned by getSignals()
+    int pending_signals_[3] = { 0, 0, 0 };
+    int signals_[3]         = { 0, 0, 0 };
+
+    // Combined Exit state from the last complete status
+    uint32_t  global_active_   = 1;
+    SimTime_t global_end_time_ = 0;
+};
+
+} // namespace SST
+
+#endif // SST_CORE_SYNC_RANKSYNCLOOKAHEAD_H
@@ -0,0 +1,184 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/sync/rankSyncNeighbor.h"
+
+#include "sst/core/event.h"
+#include "sst/core/exit.h"
+#include "sst/core/output.h"
+#include "sst/core/profile.h"
+#include "sst/core/serialization/serializer.h"
+#include "sst/core/simulation_impl.h"
+#include "sst/core/sync/syncQueue.h"
+#include "sst/core/timeConverter.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace SST {
+
+namespace {
+
+// Layout of the values combined by the reduction.  Everything is
+// reduced with MPI_MIN, so values that need a max are stored as
+// MAX_SIMTIME_T - value.
+enum ReduceIndex { NEXT_TIME, SIG_END, SIG_USR, SIG_ALRM, ACTIVE, END_TIME, REDUCE_COUNT };
+
+} // namespace
+
+RankSyncNeighbor::RankSyncNeighbor(RankInfo num_ranks) :
+    RankSyncSerialSkip(num_ranks),
+    neighbor_comm_(MPI_COMM_WORLD)
+{}
+
+RankSyncNeighbor::~RankSyncNeighbor() {}
+
+void
+RankSyncNeighbor::finalizeLinkConfigurations()
+{
+    RankSyncSerialSkip::finalizeLinkConfigurations();
+
+#ifdef SST_CONFIG_HAVE_MPI
+    // Links always go both ways, so the same ranks are sources and
+    // destinations
+    for ( auto& [rank, comm] : comm_map ) {
+        neighbors_.push_back(rank);
+    }
+    MPI_Dist_graph_create_adjacent(MPI_COMM_WORLD, neighbors_.size(), neighbors_.data(), MPI_UNWEIGHTED,
+        neighbors_.size(), neighbors_.data(), MPI_UNWEIGHTED, MPI_INFO_NULL, 0, &neighbor_comm_);
+#endif
+}
+
+void
+RankSyncNeighbor::prepareForComplete()
+{
+    // The RankSync is never deleted, so report the time spent here
+    if ( mpiWaitTime > 0.0 || reduceWaitTime > 0.0 || serializeTime > 0.0 || deserializeTime > 0.0 )
+        Output::getDefaultObject().verbose(CALL_INFO, 1, 0,
+            "RankSyncNeighbor mpiWait: %lg sec  reduceWait: %lg sec  serializeWait:  %lg sec  deserializeWait:  %lg "
+            "sec\n",
+            mpiWaitTime, reduceWaitTime, serializeTime, deserializeTime);
+
+#ifdef SST_CONFIG_HAVE_MPI
+    // Nothing is exchanged after the run, and the RankSync is never
+    // deleted, so free the communicator here before MPI_Finalize()
+    if ( neighbor_comm_ != MPI_COMM_WORLD ) {
+        MPI_Comm_free(&neighbor_comm_);
+        neighbor_comm_ = MPI_COMM_WORLD;
+    }
+#endif
+}
+
+void
+RankSyncNeighbor::execute(int thread)
+{
+    if ( thread == 0 ) {
+        exchange();
+    }
+}
+
+void
+RankSyncNeighbor::checkExit(Exit* exit)
+{
+    exit->setGlobalCount(global_active_);
+    if ( global_active_ == 0 ) exit->setEndTime(global_end_time_);
+}
+
+void
+RankSyncNeighbor::exchange()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    int num_neighbors = neighbors_.size();
+
+    std::vector<int>          send_sizes(num_neighbors);
+    std::vector<int>          recv_sizes(num_neighbors);
+    std::vector<MPI_Aint>     send_displs(num_neighbors);
+    std::vector<MPI_Aint>     recv_displs(num_neighbors);
+    std::vector<MPI_Datatype> types(num_neighbors, MPI_BYTE);
+
+    // The events sent in this sync haven't been received yet, so
+    // their delivery times are added to the time reduction here
+    SimTime_t next_time = Simulation_impl::getLocalMinimumNextActivityTime();
+
+    auto serialStart = SST::Core::Profile::now();
+    for ( int i = 0; i < num_neighbors; ++i ) {
+        RankSyncQueue* squeue = comm_map[neighbors_[i]].squeue;
+        next_time             = std::min(next_time, squeue->getMinDeliveryTime());
+
+        char* send_buffer = squeue->getData();
+        send_sizes[i]     = reinterpret_cast<RankSyncQueue::Header*>(send_buffer)->buffer_size;
+        MPI_Get_address(send_buffer, &send_displs[i]);
+    }
+    serializeTime += SST::Core::Profile::getElapsed(serialStart);
+
+    Exit*    exit = Simulation_impl::getSimulation()->getExit();
+    uint64_t local_values[REDUCE_COUNT];
+    uint64_t global_values[REDUCE_COUNT];
+    local_values[NEXT_TIME] = next_time;
+    local_values[SIG_END]   = MAX_SIMTIME_T - sig_end_;
+    local_values[SIG_USR]   = MAX_SIMTIME_T - sig_usr_;
+    local_values[SIG_ALRM]  = MAX_SIMTIME_T - sig_alrm_;
+    local_values[ACTIVE]    = MAX_SIMTIME_T - (exit->getRefCount() > 0 ? 1 : 0);
+    local_values[END_TIME]  = MAX_SIMTIME_T - exit->getEndTime();
+
+    MPI_Request reduce_req;
+    MPI_Iallreduce(local_values, global_values, REDUCE_COUNT, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD, &reduce_req);
+
+    auto waitStart = SST::Core::Profile::now();
+    MPI_Neighbor_alltoall(send_sizes.data(), 1, MPI_INT, recv_sizes.data(), 1, MPI_INT, neighbor_comm_);
+
+    size_t total = 0;
+    for ( int i = 0; i < num_neighbors; ++i ) {
+        recv_displs[i] = total;
+        total += recv_sizes[i];
+    }
+    if ( recv_buffer_.size() < total ) recv_buffer_.resize(total);
+
+    MPI_Neighbor_alltoallw(MPI_BOTTOM, send_sizes.data(), send_displs.data(), types.data(), recv_buffer_.data(),
+        recv_sizes.data(), recv_displs.data(), types.data(), neighbor_comm_);
+    mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+
+    for ( int i = 0; i < num_neighbors; ++i ) {
+        char* buffer = recv_buffer_.data() + recv_displs[i];
+
+        auto deserialStart = SST::Core::Profile::now();
+
+        SST::Core::Serialization::serializer ser;
+        ser.start_unpacking(&buffer[sizeof(RankSyncQueue::Header)], recv_sizes[i] - sizeof(RankSyncQueue::Header));
+
+        std::vector<Activity*> activities;
+        RankSyncQueue::serializeEvents(ser, activities);
+
+        deserializeTime += SST::Core::Profile::getElapsed(deserialStart);
+
+        sendEvents_sync(activities);
+    }
+
+    for ( auto& [rank, comm] : comm_map ) {
+        comm.squeue->clear();
+    }
+
+    waitStart = SST::Core::Profile::now();
+    MPI_Wait(&reduce_req, MPI_STATUS_IGNORE);
+    reduceWaitTime += SST::Core::Profile::getElapsed(waitStart);
+
+    myNextSyncTime   = global_values[NEXT_TIME] + max_period.getFactor();
+    sig_end_         = MAX_SIMTIME_T - global_values[SIG_END];
+    sig_usr_         = MAX_SIMTIME_T - global_values[SIG_USR];
+    sig_alrm_        = MAX_SIMTIME_T - global_values[SIG_ALRM];
+    global_active_   = MAX_SIMTIME_T - global_values[ACTIVE];
+    global_end_time_ = MAX_SIMTIME_T - global_values[END_TIME];
+#endif
+}
+
+} // namespace SST
@@ -0,0 +1,82 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_SYNC_RANKSYNCNEIGHBOR_H
+#define SST_CORE_SYNC_RANKSYNCNEIGHBOR_H
+
+#include "sst/core/sst_mpi.h"
+#include "sst/core/sst_types.h"
+#include "sst/core/sync/rankSyncSerialSkip.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace SST {
+
+class Exit;
+
+/**
+   RankSync that exchanges events with MPI neighborhood collectives
+   (selected with --rank-sync=neighbor).
+
+   Ranks sync at the same times as RankSyncSerialSkip, but the events
+   are exchanged with MPI_Neighbor_alltoall (buffer sizes) and
+   MPI_Neighbor_alltoallw (buffers) on a distributed graph
+   communicator built from the ranks each rank has links to.  The
+   send buffers are used in place, and the receive buffers are
+   sized from the exchanged sizes, so there is no resize protocol.
+
+   The next sync time, the signals and the Exit state are combined
+   in a single MPI_Iallreduce that is started before the exchange
+   and completed after the received events are deserialized.  This
+   is possible because the time reduction includes the earliest
+   delivery time of the events being sent, so it does not have to
+   wait for them to be received.
+ */
+class RankSyncNeighbor : public RankSyncSerialSkip
+{
+public:
+    explicit RankSyncNeighbor(RankInfo num_ranks);
+    virtual ~RankSyncNeighbor();
+
+    void execute(int thread) override;
+
+    /** Finish link configuration */
+    void finalizeLinkConfigurations() override;
+    /** Prepare for the complete() stage */
+    void prepareForComplete() override;
+
+    /** Check whether the simulation should end */
+    void checkExit(Exit* exit) override;
+
+private:
+    // Does the exchange and the reduction
+    void exchange();
+
+    MPI_Comm neighbor_comm_;
+
+    // Neighbor ranks, in the order used by neighbor_comm_
+    std::vector<int> neighbors_;
+
+    // Receive buffer for all neighbors
+    std::vector<char> recv_buffer_;
+
+    // Time spent waiting for the reduction
+    double reduceWaitTime = 0.0;
+
+    // Exit state from the last reduction
+    uint32_t  global_active_   = 1;
+    SimTime_t global_end_time_ = 0;
+};
+
+} // namespace SST
+
+#endif // SST_CORE_SYNC_RANKSYNCNEIGHBOR_H
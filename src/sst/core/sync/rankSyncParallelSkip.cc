@@ -23,6 +23,8 @@
 #include "sst/core/sync/syncQueue.h"
 #include "sst/core/timeConverter.h"
 
+#include <cinttypes>
+
 #if SST_EVENT_PROFILING
 #define SST_EVENT_PROFILE_START auto event_profile_start = std::chrono::high_resolution_clock::now();
 
@@ -46,6 +48,7 @@ SimTime_t RankSyncParallelSkip::myNextSyncTime = 0;
 RankSyncParallelSkip::RankSyncParallelSkip(RankInfo num_ranks) :
     RankSync(num_ranks),
     mpiWaitTime(0.0),
+    serializeTime(0.0),
     deserializeTime(0.0),
     send_count(0),
     serializeReadyBarrier(num_ranks.thread),
@@ -68,17 +71,10 @@ RankSyncParallelSkip::~RankSyncParallelSkip()
     }
     comm_send_map.clear();
 
-    for ( auto i = comm_recv_map.begin(); i != comm_recv_map.end(); ++i ) {
-        delete[] i->second.rbuf;
-    }
     comm_recv_map.clear();
 
     delete[] recv_count;
     delete[] link_send_queue;
-
-    if ( mpiWaitTime > 0.0 || deserializeTime > 0.0 )
-        Output::getDefaultObject().verbose(CALL_INFO, 1, 0,
-            "RankSyncParallelSkip mpiWait: %lg sec  deserializeWait:  %lg sec\n", mpiWaitTime, deserializeTime);
 }
 
 ActivityQueue*
@@ -93,7 +89,7 @@ RankSyncParallelSkip::registerLink(
         send_count++;
         comm_send_map[to_rank].to_rank = to_rank;
         queue = comm_send_map[to_rank].squeue = new RankSyncQueue(to_rank);
-        comm_send_map[to_rank].remote_size    = 4096;
+        comm_send_map[to_rank].send_buffer.init(to_rank.rank, 2 * to_rank.thread);
     }
     else {
         queue = comm_send_map[to_rank].squeue;
@@ -107,8 +103,7 @@ RankSyncParallelSkip::registerLink(
         recv_count[from_rank.thread]++;
         comm_recv_map[remote_rank_local_thread].remote_rank  = to_rank.rank;
         comm_recv_map[remote_rank_local_thread].local_thread = from_rank.thread;
-        comm_recv_map[remote_rank_local_thread].rbuf         = new char[4096];
-        comm_recv_map[remote_rank_local_thread].local_size   = 4096;
+        comm_recv_map[remote_rank_local_thread].recv_buffer.init(to_rank.rank, 2 * from_rank.thread);
     }
 
     link_maps[to_rank.rank][name] = reinterpret_cast<uintptr_t>(link);
@@ -134,11 +129,49 @@ RankSyncParallelSkip::finalizeLinkConfigurations()
     deserialize_queue.initialize(comm_recv_map.size());
     serialize_queue.initialize(comm_send_map.size());
     send_queue.initialize(comm_send_map.size());
+
+    if ( !Simulation_impl::getSimulation()->rank_sync_shmem ) return;
+
+    shm_.init();
+    for ( auto& [rank, send] : comm_send_map ) {
+        if ( shm_.isLocal(rank.rank) ) send.shm_channel = shm_.addSend(rank.rank, rank.thread);
+    }
+    for ( auto& [rank, recv] : comm_recv_map ) {
+        if ( shm_.isLocal(recv.remote_rank) )
+            recv.shm_channel = shm_.addRecv(recv.remote_rank, recv.local_thread, &recv.recv_buffer);
+    }
+    shm_.connect();
 }
 
 void
 RankSyncParallelSkip::prepareForComplete()
-{}
+{
+    // The RankSync is never deleted, so report the time spent here
+    if ( mpiWaitTime > 0.0 || serializeTime > 0.0 || deserializeTime > 0.0 )
+        Output::getDefaultObject().verbose(CALL_INFO, 1, 0,
+            "RankSyncParallelSkip mpiWait: %lg sec  serializeWait:  %lg sec  deserializeWait:  %lg sec\n",
+            mpiWaitTime, serializeTime, deserializeTime);
+
+    for ( auto& [rank, send] : comm_send_map ) {
+        if ( send.shm_channel >= 0 ) {
+            Output::getDefaultObject().verbose(CALL_INFO, 1, 0,
+                "RankSyncParallelSkip send buffer to rank %" PRIu32 " thread %" PRIu32 ": shared memory\n", rank.rank,
+                rank.thread);
+            continue;
+        }
+        Output::getDefaultObject().verbose(CALL_INFO, 1, 0,
+            "RankSyncParallelSkip send buffer to rank %" PRIu32 " thread %" PRIu32 ": %" PRIu32 " bytes, %" PRIu32
+            " resizes (%" PRIu32 " unpredicted)\n",
+            rank.rank, rank.thread, send.send_buffer.getRemoteSize(), send.send_buffer.getResizeCount(),
+            send.send_buffer.getMissCount());
+    }
+    for ( auto& [rank, recv] : comm_recv_map ) {
+        Output::getDefaultObject().verbose(CALL_INFO, 1, 0,
+            "RankSyncParallelSkip recv buffer from rank %" PRIu32 " thread %" PRIu32 ": %" PRIu32 " bytes, %" PRIu32
+            " resizes\n",
+            recv.remote_rank, recv.local_thread, recv.recv_buffer.getSize(), recv.recv_buffer.getResizeCount());
+    }
+}
 
 void
 RankSyncParallelSkip::setSignals(int end, int usr, int alrm)
@@ -166,7 +199,7 @@ RankSyncParallelSkip::getDataSize() const
     }
 
     for ( auto it = comm_recv_map.begin(); it != comm_recv_map.end(); ++it ) {
-        count += it->second.local_size;
+        count += it->second.recv_buffer.getSize();
     }
     return count;
 }
@@ -192,14 +225,14 @@ RankSyncParallelSkip::exchange_slave(int thread)
     // Check the serialize_queue for work.
     comm_send_pair* ser;
 
-    Simulation_impl* sim = Simulation_impl::getSimulation();
+    [[maybe_unused]] Simulation_impl* sim = Simulation_impl::getSimulation();
 
     while ( serialize_queue.try_remove(ser) ) {
         // Measures serialization time
         SST_EVENT_PROFILE_START
 
         // Serialize the events
-        ser->sbuf = ser->squeue->getData();
+        serializeData(ser);
 
         SST_EVENT_PROFILE_STOP
 
@@ -211,10 +244,6 @@ RankSyncParallelSkip::exchange_slave(int thread)
 
     int my_recv_count = recv_count[thread];
 
-    // Do nothing until there are events to be sent on this thread's
-    // links
-    SimTime_t current_cycle = sim->getCurrentSimCycle();
-
     // Two things left to do.  Deserialize receives and send
     // deserialized events on the proper link.  Will preferentially
     // send first.
@@ -226,11 +255,7 @@ RankSyncParallelSkip::exchange_slave(int thread)
             // comm_recv_pair* recv = link_send_queue[thread].remove();
             my_recv_count--;
 
-            for ( size_t i = 0; i < recv->activity_vec.size(); i++ ) {
-                Event*    ev    = static_cast<Event*>(recv->activity_vec[i]);
-                SimTime_t delay = ev->getDeliveryTime() - current_cycle;
-                getDeliveryLink(ev)->send(delay, ev);
-            }
+            sendEvents_sync(recv->activity_vec);
             recv->activity_vec.clear();
         }
         else if ( deserialize_queue.try_remove(recv) ) {
@@ -247,10 +272,6 @@ RankSyncParallelSkip::exchange_master(int UNUSED(thread))
 {
 #ifdef SST_CONFIG_HAVE_MPI
 
-    // Maximum number of outstanding requests is 3 times the number
-    // of ranks I communicate with (1 recv, 2 sends per rank)
-    auto sreqs      = std::make_unique<MPI_Request[]>(2 * comm_send_map.size());
-    int  sreq_count = 0;
     // First thing to do is fill the serialize_queue.
     for ( auto i = comm_send_map.begin(); i != comm_send_map.end(); ++i ) {
         serialize_queue.try_insert(&(i->second));
@@ -262,10 +283,11 @@ RankSyncParallelSkip::exchange_master(int UNUSED(thread))
 
     for ( auto i = comm_recv_map.begin(); i != comm_recv_map.end(); ++i ) {
         // Post all the receives
-        int tag             = 2 * i->second.local_thread;
         i->second.recv_done = false;
-        MPI_Irecv(
-            i->second.rbuf, i->second.local_size, MPI_BYTE, i->second.remote_rank, tag, MPI_COMM_WORLD, &i->second.req);
+        if ( i->second.shm_channel >= 0 )
+            shm_.startRecv(i->second.shm_channel);
+        else
+            i->second.recv_buffer.start();
     }
 
     // Do all the sends, but if there are no sends to do, then help
@@ -281,29 +303,15 @@ RankSyncParallelSkip::exchange_master(int UNUSED(thread))
         if ( send_queue.try_remove(send) ) {
             my_send_count--;
 
-            char*                  send_buffer = send->sbuf;
-            // Cast to Header so we can get/fill in data
-            RankSyncQueue::Header* hdr         = reinterpret_cast<RankSyncQueue::Header*>(send_buffer);
-            int                    tag         = 2 * send->to_rank.thread;
-            // Check to see if remote queue is big enough for data
-            if ( send->remote_size < hdr->buffer_size ) {
-                // not big enough, send message that will tell remote side to get larger buffer
-                hdr->mode = 1;
-                MPI_Isend(send_buffer, sizeof(RankSyncQueue::Header), MPI_BYTE, send->to_rank.rank /*dest*/, tag,
-                    MPI_COMM_WORLD, &sreqs[sreq_count++]);
-                send->remote_size = hdr->buffer_size;
-                tag               = 2 * send->to_rank.thread + 1;
-            }
-            else {
-                hdr->mode = 0;
-            }
-            MPI_Isend(send_buffer, hdr->buffer_size, MPI_BYTE, send->to_rank.rank /*dest*/, tag, MPI_COMM_WORLD,
-                &sreqs[sreq_count++]);
+            if ( send->shm_channel >= 0 )
+                shm_.startSend(send->shm_channel, send->sbuf);
+            else
+                send->send_buffer.start(send->sbuf);
         }
         else if ( serialize_queue.try_remove(send) ) {
             // Serialize the events
             SST_EVENT_PROFILE_START
-            send->sbuf = send->squeue->getData();
+            serializeData(send);
             SST_EVENT_PROFILE_STOP
 
             // Send back to master to do MPI send
@@ -317,32 +325,23 @@ RankSyncParallelSkip::exchange_master(int UNUSED(thread))
     // Do all the receives as they arrive
     int receives_to_process = comm_recv_map.size();
     while ( receives_to_process != 0 ) {
+        shm_.progress();
         for ( auto i = comm_recv_map.begin(); i != comm_recv_map.end(); ++i ) {
             if ( !i->second.recv_done ) {
-                int flag;
-                MPI_Test(&i->second.req, &flag, MPI_STATUS_IGNORE);
-                if ( flag ) {
+                if ( i->second.shm_channel >= 0 ) {
+                    if ( shm_.isRecvDone(i->second.shm_channel) ) {
+                        receives_to_process--;
+                        i->second.recv_done = true;
+                        deserialize_queue.try_insert(&(i->second));
+                    }
+                }
+                else if ( i->second.recv_buffer.test() ) {
                     receives_to_process--;
                     i->second.recv_done = true;
 
-                    // Get the buffer and deserialize all the events
-                    char* buffer = i->second.rbuf;
-
-                    RankSyncQueue::Header* hdr  = reinterpret_cast<RankSyncQueue::Header*>(buffer);
-                    unsigned int           size = hdr->buffer_size;
-                    int                    mode = hdr->mode;
-
-                    if ( mode == 1 ) {
-                        // May need to resize the buffer
-                        if ( size > i->second.local_size ) {
-                            delete[] i->second.rbuf;
-                            i->second.rbuf       = new char[size];
-                            i->second.local_size = size;
-                        }
-                        MPI_Recv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->second.remote_rank,
-                            2 * i->second.local_thread + 1, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-                        buffer = i->second.rbuf;
-                    }
+                    // Receives the rest of the message if it didn't
+                    // fit in the buffer
+                    i->second.recv_buffer.complete();
 
                     deserialize_queue.try_insert(&(i->second));
                 }
@@ -350,12 +349,18 @@ RankSyncParallelSkip::exchange_master(int UNUSED(thread))
         }
     }
 
+    // Finish streaming sends that didn't fit in the shared memory
+    // rings
+    shm_.wait();
+
     // For now simply call exchange_slave() to deliver events
     exchange_slave(0); /* Barriers at end */
 
     // Clear the RankSyncQueues used to send the data after all the sends have completed
     // waitStart = SST::Core::Profile::now();
-    MPI_Waitall(sreq_count, sreqs.get(), MPI_STATUSES_IGNORE);
+    for ( auto i = comm_send_map.begin(); i != comm_send_map.end(); ++i ) {
+        i->second.send_buffer.wait();
+    }
     // mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
 
     for ( auto i = comm_send_map.begin(); i != comm_send_map.end(); ++i ) {
@@ -393,18 +398,9 @@ RankSyncParallelSkip::exchangeLinkUntimedData(int UNUSED_WO_MPI(thread), std::at
     if ( thread != 0 ) {
         return;
     }
-    // Maximum number of outstanding requests is 3 times the number
-    // of ranks I communicate with (1 recv, 2 sends per rank)
-    auto sreqs      = std::make_unique<MPI_Request[]>(2 * comm_send_map.size());
-    auto rreqs      = std::make_unique<MPI_Request[]>(comm_recv_map.size());
-    int  rreq_count = 0;
-    int  sreq_count = 0;
-
     for ( auto i = comm_recv_map.begin(); i != comm_recv_map.end(); ++i ) {
         // Post all the receives
-        int tag = 2 * i->second.local_thread;
-        MPI_Irecv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->second.remote_rank, tag, MPI_COMM_WORLD,
-            &rreqs[rreq_count++]);
+        i->second.recv_buffer.start();
     }
 
     for ( auto i = comm_send_map.begin(); i != comm_send_map.end(); ++i ) {
@@ -412,55 +408,27 @@ RankSyncParallelSkip::exchangeLinkUntimedData(int UNUSED_WO_MPI(thread), std::at
         // Do all the sends
         // Get the buffer from the syncQueue
         char* send_buffer = i->second.squeue->getData();
-
-        // Cast to Header so we can get/fill in data
-        RankSyncQueue::Header* hdr = reinterpret_cast<RankSyncQueue::Header*>(send_buffer);
-        int                    tag = 2 * i->second.to_rank.thread;
-        // Check to see if remote queue is big enough for data
-        if ( i->second.remote_size < hdr->buffer_size ) {
-            // not big enough, send message that will tell remote side to get larger buffer
-            hdr->mode = 1;
-            MPI_Isend(send_buffer, sizeof(RankSyncQueue::Header), MPI_BYTE, i->second.to_rank.rank /*dest*/, tag,
-                MPI_COMM_WORLD, &sreqs[sreq_count++]);
-            i->second.remote_size = hdr->buffer_size;
-            tag                   = 2 * i->second.to_rank.thread + 1;
-        }
-        else {
-            hdr->mode = 0;
-        }
-        MPI_Isend(send_buffer, hdr->buffer_size, MPI_BYTE, i->second.to_rank.rank /*dest*/, tag, MPI_COMM_WORLD,
-            &sreqs[sreq_count++]);
+        i->second.send_buffer.start(send_buffer);
     }
 
     // Wait for all recvs to complete
-    MPI_Waitall(rreq_count, rreqs.get(), MPI_STATUSES_IGNORE);
+    for ( auto i = comm_recv_map.begin(); i != comm_recv_map.end(); ++i ) {
+        i->second.recv_buffer.wait();
+    }
 
     for ( auto i = comm_recv_map.begin(); i != comm_recv_map.end(); ++i ) {
 
         // Get the buffer and deserialize all the events
-        char* buffer = i->second.rbuf;
+        char* buffer = i->second.recv_buffer.complete();
 
         RankSyncQueue::Header* hdr  = reinterpret_cast<RankSyncQueue::Header*>(buffer);
         unsigned int           size = hdr->buffer_size;
-        int                    mode = hdr->mode;
-
-        if ( mode == 1 ) {
-            // May need to resize the buffer
-            if ( size > i->second.local_size ) {
-                delete[] i->second.rbuf;
-                i->second.rbuf       = new char[size];
-                i->second.local_size = size;
-            }
-            MPI_Recv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->second.remote_rank,
-                2 * i->second.local_thread + 1, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-            buffer = i->second.rbuf;
-        }
 
         SST::Core::Serialization::serializer ser;
         ser.start_unpacking(&buffer[sizeof(RankSyncQueue::Header)], size - sizeof(RankSyncQueue::Header));
 
         std::vector<Activity*> activities;
-        SST_SER(activities);
+        RankSyncQueue::serializeEvents(ser, activities);
 
         for ( unsigned int j = 0; j < activities.size(); j++ ) {
 
@@ -470,7 +438,9 @@ RankSyncParallelSkip::exchangeLinkUntimedData(int UNUSED_WO_MPI(thread), std::at
     }
 
     // Clear the RankSyncQueues used to send the data after all the sends have completed
-    MPI_Waitall(sreq_count, sreqs.get(), MPI_STATUSES_IGNORE);
+    for ( auto i = comm_send_map.begin(); i != comm_send_map.end(); ++i ) {
+        i->second.send_buffer.wait();
+    }
 
     for ( auto i = comm_send_map.begin(); i != comm_send_map.end(); ++i ) {
         i->second.squeue->clear();
@@ -488,7 +458,7 @@ RankSyncParallelSkip::exchangeLinkUntimedData(int UNUSED_WO_MPI(thread), std::at
 void
 RankSyncParallelSkip::deserializeMessage(comm_recv_pair* msg)
 {
-    char*                  buffer = msg->rbuf;
+    char*                  buffer = msg->recv_buffer.getBuffer();
     RankSyncQueue::Header* hdr    = reinterpret_cast<RankSyncQueue::Header*>(buffer);
     unsigned int           size   = hdr->buffer_size;
 
@@ -497,9 +467,25 @@ RankSyncParallelSkip::deserializeMessage(comm_recv_pair* msg)
     SST::Core::Serialization::serializer ser;
 
     ser.start_unpacking(&buffer[sizeof(RankSyncQueue::Header)], size - sizeof(RankSyncQueue::Header));
-    SST_SER(msg->activity_vec);
+    RankSyncQueue::serializeEvents(ser, msg->activity_vec);
+
+    double elapsed = SST::Core::Profile::getElapsed(deserialStart);
+
+    std::lock_guard<Core::ThreadSafe::Spinlock> slock(lock);
+    deserializeTime += elapsed;
+}
 
-    deserializeTime += SST::Core::Profile::getElapsed(deserialStart);
+void
+RankSyncParallelSkip::serializeData(comm_send_pair* msg)
+{
+    auto serialStart = SST::Core::Profile::now();
+
+    msg->sbuf = msg->squeue->getData();
+
+    double elapsed = SST::Core::Profile::getElapsed(serialStart);
+
+    std::lock_guard<Core::ThreadSafe::Spinlock> slock(lock);
+    serializeTime += elapsed;
 }
 
 int RankSyncParallelSkip::sig_end_(0);
@@ -14,6 +14,8 @@
 
 #include "sst/core/sst_mpi.h"
 #include "sst/core/sst_types.h"
+#include "sst/core/sync/rankSyncBuffers.h"
+#include "sst/core/sync/rankSyncSharedMemory.h"
 #include "sst/core/sync/syncManager.h"
 #include "sst/core/threadsafe.h"
 
@@ -67,17 +69,20 @@ private:
 
     struct comm_send_pair : public SST::Core::Serialization::serializable
     {
-        RankInfo       to_rank;
-        RankSyncQueue* squeue; // RankSyncQueue
-        char*          sbuf;
-        uint32_t       remote_size;
+        RankInfo           to_rank;
+        RankSyncQueue*     squeue; // RankSyncQueue
+        char*              sbuf;
+        RankSyncSendBuffer send_buffer;
+        // Shared memory channel, or -1 if the rank is on another node
+        int                shm_channel = -1;
 
         void serialize_order(SST::Core::Serialization::serializer& ser) override
         {
             SST_SER(to_rank);
             // squeue - empty so recreate on restart
             // sbuf - empty so recreate on restart
-            // remote_size - don't need
+            // send_buffer - don't need
+            // shm_channel - don't need
         }
         ImplementSerializable(comm_send_pair)
     };
@@ -86,21 +91,20 @@ private:
     {
         uint32_t               remote_rank;
         uint32_t               local_thread;
-        char*                  rbuf; // receive buffer
+        RankSyncRecvBuffer     recv_buffer;
         std::vector<Activity*> activity_vec;
-        uint32_t               local_size;
         bool                   recv_done;
-#ifdef SST_CONFIG_HAVE_MPI
-        MPI_Request req;
-#endif
+        // Shared memory channel, or -1 if the rank is on another node
+        int                    shm_channel = -1;
+
         void serialize_order(SST::Core::Serialization::serializer& ser) override
         {
             SST_SER(remote_rank);
             SST_SER(local_thread);
             // activity_vec - empty so recreate on restart
-            // rbuf - empty so recreate on restart
+            // recv_buffer - empty so recreate on restart
             // recv_done - don't need
-            // req - don't need
+            // shm_channel - don't need
         }
         ImplementSerializable(comm_recv_pair)
     };
@@ -116,8 +120,15 @@ private:
     link_map_t      link_map;
 
     double mpiWaitTime;
+    // Serialization and deserialization are done by all the threads.
+    // These are only updated while holding lock.
+    double serializeTime;
     double deserializeTime;
 
+    // Used for the ranks on this node with --rank-sync-shmem.  Only
+    // the master thread uses it.
+    RankSyncSharedMemory shm_;
+
     int* recv_count;
     int  send_count;
 
@@ -127,6 +138,7 @@ private:
     SST::Core::ThreadSafe::BoundedQueue<comm_send_pair*>    serialize_queue;
     SST::Core::ThreadSafe::BoundedQueue<comm_send_pair*>    send_queue;
 
+    void serializeData(comm_send_pair* msg);
     void deserializeMessage(comm_recv_pair* msg);
 
     Core::ThreadSafe::Barrier serializeReadyBarrier;
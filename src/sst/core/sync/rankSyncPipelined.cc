@@ -0,0 +1,212 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/sync/rankSyncPipelined.h"
+
+#include "sst/core/event.h"
+#include "sst/core/exit.h"
+#include "sst/core/output.h"
+#include "sst/core/profile.h"
+#include "sst/core/serialization/serializer.h"
+#include "sst/core/simulation_impl.h"
+#include "sst/core/sync/syncQueue.h"
+#include "sst/core/timeConverter.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace SST {
+
+namespace {
+
+// Tag used for the event buffers, so they can't match the messages
+// used by exchangeLinkUntimedData()
+constexpr int PIPELINED_TAG = 3;
+
+} // namespace
+
+RankSyncPipelined::RankSyncPipelined(RankInfo num_ranks) :
+    RankSyncSerialSkip(num_ranks)
+{
+    // The first window starts at 0 and the second one has to end by
+    // the minimum latency, since nothing is received before then
+    myNextSyncTime = max_period.getFactor() / 2;
+}
+
+RankSyncPipelined::~RankSyncPipelined() {}
+
+void
+RankSyncPipelined::finalizeLinkConfigurations()
+{
+    RankSyncSerialSkip::finalizeLinkConfigurations();
+#ifdef SST_CONFIG_HAVE_MPI
+    send_reqs_.resize(comm_map.size());
+#endif
+}
+
+void
+RankSyncPipelined::prepareForComplete()
+{
+    // All ranks stop after the same sync, so there is one more
+    // buffer from each neighbor.  The events in it are after the end
+    // of the simulation.
+    if ( pending_ ) {
+        receive(false);
+        complete();
+    }
+
+    // The RankSync is never deleted, so report the time spent here
+    if ( mpiWaitTime > 0.0 || reduceWaitTime > 0.0 || serializeTime > 0.0 || deserializeTime > 0.0 )
+        Output::getDefaultObject().verbose(CALL_INFO, 1, 0,
+            "RankSyncPipelined mpiWait: %lg sec  reduceWait: %lg sec  serializeWait:  %lg sec  deserializeWait:  %lg "
+            "sec\n",
+            mpiWaitTime, reduceWaitTime, serializeTime, deserializeTime);
+}
+
+void
+RankSyncPipelined::execute(int thread)
+{
+    if ( thread == 0 ) {
+        exchange();
+    }
+}
+
+void
+RankSyncPipelined::checkExit(Exit* exit)
+{
+    exit->setGlobalCount(global_active_);
+    if ( global_active_ == 0 ) exit->setEndTime(global_end_time_);
+}
+
+void
+RankSyncPipelined::receive(bool UNUSED_WO_MPI(deliver))
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    for ( auto& [rank, comm] : comm_map ) {
+        // The size isn't known ahead of time, so probe for it and
+        // grow the receive buffer if needed
+        auto        waitStart = SST::Core::Profile::now();
+        MPI_Message msg;
+        MPI_Status  status;
+        int         size;
+        MPI_Mprobe(rank, PIPELINED_TAG, MPI_COMM_WORLD, &msg, &status);
+        MPI_Get_count(&status, MPI_BYTE, &size);
+        comm.recv_buffer.reserve(size);
+        char* buffer = comm.recv_buffer.getBuffer();
+        MPI_Mrecv(buffer, size, MPI_BYTE, &msg, MPI_STATUS_IGNORE);
+        mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+
+        auto deserialStart = SST::Core::Profile::now();
+
+        SST::Core::Serialization::serializer ser;
+        ser.start_unpacking(&buffer[sizeof(RankSyncQueue::Header)], size - sizeof(RankSyncQueue::Header));
+
+        std::vector<Activity*> activities;
+        RankSyncQueue::serializeEvents(ser, activities);
+
+        deserializeTime += SST::Core::Profile::getElapsed(deserialStart);
+
+        if ( deliver ) {
+            sendEvents_sync(activities);
+        }
+        else {
+            for ( auto* activity : activities ) {
+                delete activity;
+            }
+        }
+    }
+#endif
+}
+
+void
+RankSyncPipelined::complete()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    auto waitStart = SST::Core::Profile::now();
+    MPI_Waitall(send_reqs_.size(), send_reqs_.data(), MPI_STATUSES_IGNORE);
+    mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+
+    waitStart = SST::Core::Profile::now();
+    MPI_Wait(&reduce_req_, MPI_STATUS_IGNORE);
+    reduceWaitTime += SST::Core::Profile::getElapsed(waitStart);
+
+    global_min_      = global_values_[NEXT_TIME];
+    sig_end_         = MAX_SIMTIME_T - global_values_[SIG_END];
+    sig_usr_         = MAX_SIMTIME_T - global_values_[SIG_USR];
+    sig_alrm_        = MAX_SIMTIME_T - global_values_[SIG_ALRM];
+    global_active_   = MAX_SIMTIME_T - global_values_[ACTIVE];
+    global_end_time_ = MAX_SIMTIME_T - global_values_[END_TIME];
+
+    pending_ = false;
+#endif
+}
+
+void
+RankSyncPipelined::exchange()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    // The signals set for this sync are sent in this reduction, and
+    // the ones returned are from the previous one
+    int local_signals[3] = { sig_end_, sig_usr_, sig_alrm_ };
+    sig_end_             = 0;
+    sig_usr_             = 0;
+    sig_alrm_            = 0;
+
+    if ( pending_ ) {
+        receive(true);
+        complete();
+    }
+
+    // The events sent in the window that just ended can't be sent
+    // before the start of the window or the global minimum from the
+    // previous sync, so they can't be delivered before the latency
+    // after the later of those.  They are received in the next sync,
+    // so that is when it has to be.
+    SimTime_t now   = myNextSyncTime;
+    myNextSyncTime  = std::max(prev_sync_time_, global_min_) + max_period.getFactor();
+    prev_sync_time_ = now;
+
+    // The events sent now haven't been received yet, so their
+    // delivery times are added to the time reduction here
+    SimTime_t next_time = Simulation_impl::getLocalMinimumNextActivityTime();
+
+    int req = 0;
+    for ( auto& [rank, comm] : comm_map ) {
+        next_time = std::min(next_time, comm.squeue->getMinDeliveryTime());
+
+        auto  serialStart = SST::Core::Profile::now();
+        char* send_buffer = comm.squeue->getData();
+        serializeTime += SST::Core::Profile::getElapsed(serialStart);
+
+        // The buffer isn't touched again until the sends complete in
+        // the next sync
+        uint32_t size = reinterpret_cast<RankSyncQueue::Header*>(send_buffer)->buffer_size;
+        MPI_Isend(send_buffer, size, MPI_BYTE, rank, PIPELINED_TAG, MPI_COMM_WORLD, &send_reqs_[req++]);
+    }
+
+    Exit* exit               = Simulation_impl::getSimulation()->getExit();
+    local_values_[NEXT_TIME] = next_time;
+    local_values_[SIG_END]   = MAX_SIMTIME_T - local_signals[0];
+    local_values_[SIG_USR]   = MAX_SIMTIME_T - local_signals[1];
+    local_values_[SIG_ALRM]  = MAX_SIMTIME_T - local_signals[2];
+    local_values_[ACTIVE]    = MAX_SIMTIME_T - (exit->getRefCount() > 0 ? 1 : 0);
+    local_values_[END_TIME]  = MAX_SIMTIME_T - exit->getEndTime();
+
+    MPI_Iallreduce(
+        local_values_, global_values_, REDUCE_COUNT, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD, &reduce_req_);
+
+    pending_ = true;
+#endif
+}
+
+} // namespace SST
@@ -0,0 +1,104 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_SYNC_RANKSYNCPIPELINED_H
+#define SST_CORE_SYNC_RANKSYNCPIPELINED_H
+
+#include "sst/core/sst_mpi.h"
+#include "sst/core/sst_types.h"
+#include "sst/core/sync/rankSyncSerialSkip.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace SST {
+
+class Exit;
+
+/**
+   RankSync that overlaps each exchange with the next sync window
+   (selected with --rank-sync=pipelined).
+
+   With a minimum latency of L between ranks, an event sent in a
+   window that starts at time S can't be delivered before S + L.  If
+   two consecutive windows together are no longer than L, the events
+   sent in one window aren't needed until the end of the next one.
+   So at each sync the events from the window that just ended are
+   sent without waiting, and the events sent by the other ranks in
+   the window before it are received and merged.  Ranks only wait
+   for each other when one falls more than a window behind.
+
+   The global minimum next activity time, the signals and the Exit
+   state are combined with an MPI_Iallreduce that is completed at
+   the following sync.  Because all ranks use the same reduced
+   values, they all sync at the same times, and the minimum is used
+   to skip ahead the same way RankSyncSerialSkip does.  Exit and
+   signals are seen one sync later than with RankSyncSerialSkip.
+ */
+class RankSyncPipelined : public RankSyncSerialSkip
+{
+public:
+    explicit RankSyncPipelined(RankInfo num_ranks);
+    virtual ~RankSyncPipelined();
+
+    void execute(int thread) override;
+
+    /** Finish link configuration */
+    void finalizeLinkConfigurations() override;
+    /** Prepare for the complete() stage */
+    void prepareForComplete() override;
+
+    /** Check whether the simulation should end */
+    void checkExit(Exit* exit) override;
+
+private:
+    // Does the exchange and starts the reduction for the next sync
+    void exchange();
+
+    // Receives the events sent in the previous sync and delivers
+    // them, or deletes them if deliver is false
+    void receive(bool deliver);
+
+    // Completes the sends and the reduction started in the previous
+    // sync
+    void complete();
+
+    // Layout of the values combined by the reduction.  Everything is
+    // reduced with MPI_MIN, so values that need a max are stored as
+    // MAX_SIMTIME_T - value.
+    enum ReduceIndex { NEXT_TIME, SIG_END, SIG_USR, SIG_ALRM, ACTIVE, END_TIME, REDUCE_COUNT };
+
+#ifdef SST_CONFIG_HAVE_MPI
+    // Requests started in the previous sync
+    std::vector<MPI_Request> send_reqs_;
+    MPI_Request              reduce_req_;
+#endif
+    bool pending_ = false;
+
+    uint64_t local_values_[REDUCE_COUNT];
+    uint64_t global_values_[REDUCE_COUNT];
+
+    // Time of the previous sync and lower bound on the time of any
+    // activity after it
+    SimTime_t prev_sync_time_ = 0;
+    SimTime_t global_min_     = 0;
+
+    // Time spent waiting for the reduction
+    double reduceWaitTime = 0.0;
+
+    // Exit state from the last reduction
+    uint32_t  global_active_   = 1;
+    SimTime_t global_end_time_ = 0;
+};
+
+} // namespace SST
+
+#endif // SST_CORE_SYNC_RANKSYNCPIPELINED_H
@@ -23,6 +23,8 @@
 #include "sst/core/sync/syncQueue.h"
 #include "sst/core/timeConverter.h"
 
+#include <cinttypes>
+
 #if SST_EVENT_PROFILING
 #define SST_EVENT_PROFILE_START auto event_profile_start = std::chrono::high_resolution_clock::now();
 
@@ -45,6 +47,7 @@ SimTime_t RankSyncSerialSkip::myNextSyncTime = 0;
 RankSyncSerialSkip::RankSyncSerialSkip(RankInfo num_ranks) :
     RankSync(num_ranks),
     mpiWaitTime(0.0),
+    serializeTime(0.0),
     deserializeTime(0.0)
 {
     max_period     = Simulation_impl::getSimulation()->getMinPartTC();
@@ -57,10 +60,6 @@ RankSyncSerialSkip::~RankSyncSerialSkip()
         delete i->second.squeue;
     }
     comm_map.clear();
-
-    if ( mpiWaitTime > 0.0 || deserializeTime > 0.0 )
-        Output::getDefaultObject().verbose(CALL_INFO, 1, 0,
-            "RankSyncSerialSkip mpiWait: %lg sec  deserializeWait:  %lg sec\n", mpiWaitTime, deserializeTime);
 }
 
 ActivityQueue*
@@ -72,9 +71,8 @@ RankSyncSerialSkip::registerLink(
     RankSyncQueue* queue;
     if ( comm_map.count(to_rank.rank) == 0 ) {
         queue = comm_map[to_rank.rank].squeue = new RankSyncQueue(to_rank);
-        comm_map[to_rank.rank].rbuf           = new char[4096];
-        comm_map[to_rank.rank].local_size     = 4096;
-        comm_map[to_rank.rank].remote_size    = 4096;
+        comm_map[to_rank.rank].send_buffer.init(to_rank.rank, 1);
+        comm_map[to_rank.rank].recv_buffer.init(to_rank.rank, 1);
     }
     else {
         queue = comm_map[to_rank.rank].squeue;
@@ -97,11 +95,42 @@ RankSyncSerialSkip::setRestartTime(SimTime_t time)
 
 void
 RankSyncSerialSkip::finalizeLinkConfigurations()
-{}
+{
+    if ( !Simulation_impl::getSimulation()->rank_sync_shmem ) return;
+
+    shm_.init();
+    for ( auto& [rank, comm] : comm_map ) {
+        if ( shm_.isLocal(rank) ) {
+            comm.shm_send = shm_.addSend(rank, 0);
+            comm.shm_recv = shm_.addRecv(rank, 0, &comm.recv_buffer);
+        }
+    }
+    shm_.connect();
+}
 
 void
 RankSyncSerialSkip::prepareForComplete()
-{}
+{
+    // The RankSync is never deleted, so report the time spent here
+    if ( mpiWaitTime > 0.0 || serializeTime > 0.0 || deserializeTime > 0.0 )
+        Output::getDefaultObject().verbose(CALL_INFO, 1, 0,
+            "RankSyncSerialSkip mpiWait: %lg sec  serializeWait:  %lg sec  deserializeWait:  %lg sec\n", mpiWaitTime,
+            serializeTime, deserializeTime);
+
+    for ( auto& [rank, comm] : comm_map ) {
+        if ( comm.shm_send >= 0 ) {
+            Output::getDefaultObject().verbose(CALL_INFO, 1, 0,
+                "RankSyncSerialSkip rank %d buffers  shared memory  recv: %" PRIu32 " bytes, %" PRIu32 " resizes\n",
+                rank, comm.recv_buffer.getSize(), comm.recv_buffer.getResizeCount());
+            continue;
+        }
+        Output::getDefaultObject().verbose(CALL_INFO, 1, 0,
+            "RankSyncSerialSkip rank %d buffers  send: %" PRIu32 " bytes, %" PRIu32 " resizes (%" PRIu32
+            " unpredicted)  recv: %" PRIu32 " bytes, %" PRIu32 " resizes\n",
+            rank, comm.send_buffer.getRemoteSize(), comm.send_buffer.getResizeCount(),
+            comm.send_buffer.getMissCount(), comm.recv_buffer.getSize(), comm.recv_buffer.getResizeCount());
+    }
+}
 
 void
 RankSyncSerialSkip::setSignals(int end, int usr, int alrm)
@@ -125,7 +154,7 @@ RankSyncSerialSkip::getDataSize() const
 {
     size_t count = 0;
     for ( comm_map_t::const_iterator it = comm_map.begin(); it != comm_map.end(); ++it ) {
-        count += (it->second.squeue->getDataSize() + it->second.local_size);
+        count += (it->second.squeue->getDataSize() + it->second.recv_buffer.getSize());
     }
     return count;
 }
@@ -142,14 +171,7 @@ void
 RankSyncSerialSkip::exchange()
 {
 #ifdef SST_CONFIG_HAVE_MPI
-    // Maximum number of outstanding requests is 3 times the number
-    // of ranks I communicate with (1 recv, 2 sends per rank)
-    auto sreqs      = std::make_unique<MPI_Request[]>(2 * comm_map.size());
-    auto rreqs      = std::make_unique<MPI_Request[]>(comm_map.size());
-    int  sreq_count = 0;
-    int  rreq_count = 0;
-
-    Simulation_impl* sim = Simulation_impl::getSimulation();
+    [[maybe_unused]] Simulation_impl* sim = Simulation_impl::getSimulation();
 
     for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
 
@@ -157,58 +179,41 @@ RankSyncSerialSkip::exchange()
 
         // Do all the sends
         // Get the buffer from the syncQueue
+        auto  serialStart = SST::Core::Profile::now();
         char* send_buffer = i->second.squeue->getData();
+        serializeTime += SST::Core::Profile::getElapsed(serialStart);
 
         SST_EVENT_PROFILE_STOP
 
-        // Cast to Header so we can get/fill in data
-        RankSyncQueue::Header* hdr = reinterpret_cast<RankSyncQueue::Header*>(send_buffer);
-        // Simulation_impl::getSimulation()->getSimulationOutput().output("Data size = %d\n", hdr->buffer_size);
-        int                    tag = 1;
-        // Check to see if remote queue is big enough for data
-        if ( i->second.remote_size < hdr->buffer_size ) {
-            // not big enough, send message that will tell remote side to get larger buffer
-            hdr->mode = 1;
-            MPI_Isend(send_buffer, sizeof(RankSyncQueue::Header), MPI_BYTE, i->first /*dest*/, tag, MPI_COMM_WORLD,
-                &sreqs[sreq_count++]);
-            i->second.remote_size = hdr->buffer_size;
-            tag                   = 2;
-        }
-        else {
-            hdr->mode = 0;
+        if ( i->second.shm_send >= 0 ) {
+            shm_.startSend(i->second.shm_send, send_buffer);
+            shm_.startRecv(i->second.shm_recv);
+            continue;
         }
-        MPI_Isend(
-            send_buffer, hdr->buffer_size, MPI_BYTE, i->first /*dest*/, tag, MPI_COMM_WORLD, &sreqs[sreq_count++]);
+
+        i->second.send_buffer.start(send_buffer);
 
         // Post all the receives
-        MPI_Irecv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 1, MPI_COMM_WORLD, &rreqs[rreq_count++]);
+        i->second.recv_buffer.start();
     }
 
-    // Wait for all sends and recvs to complete
-    SimTime_t current_cycle = sim->getCurrentSimCycle();
-
+    // Wait for all recvs to complete.  The ranks on this node go
+    // first, since their data moves while the MPI transfers are in
+    // flight.
     auto waitStart = SST::Core::Profile::now();
-    MPI_Waitall(rreq_count, rreqs.get(), MPI_STATUSES_IGNORE);
+    shm_.wait();
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        if ( i->second.shm_recv < 0 ) i->second.recv_buffer.wait();
+    }
     mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
 
     for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
         // Get the buffer and deserialize all the events
-        char* buffer = i->second.rbuf;
+        char* buffer =
+            i->second.shm_recv >= 0 ? i->second.recv_buffer.getBuffer() : i->second.recv_buffer.complete();
 
         RankSyncQueue::Header* hdr  = reinterpret_cast<RankSyncQueue::Header*>(buffer);
         unsigned int           size = hdr->buffer_size;
-        int                    mode = hdr->mode;
-
-        if ( mode == 1 ) {
-            // May need to resize the buffer
-            if ( size > i->second.local_size ) {
-                delete[] i->second.rbuf;
-                i->second.rbuf       = new char[size];
-                i->second.local_size = size;
-            }
-            MPI_Recv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 2, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-            buffer = i->second.rbuf;
-        }
 
         auto deserialStart = SST::Core::Profile::now();
 
@@ -217,23 +222,20 @@ RankSyncSerialSkip::exchange()
 
         std::vector<Activity*> activities;
         activities.clear();
-        SST_SER(activities);
+        RankSyncQueue::serializeEvents(ser, activities);
 
         deserializeTime += SST::Core::Profile::getElapsed(deserialStart);
 
-        for ( unsigned int j = 0; j < activities.size(); j++ ) {
-
-            Event*    ev    = static_cast<Event*>(activities[j]);
-            SimTime_t delay = ev->getDeliveryTime() - current_cycle;
-            getDeliveryLink(ev)->send(delay, ev);
-        }
+        sendEvents_sync(activities);
 
         activities.clear();
     }
 
     // Clear the RankSyncQueues used to send the data after all the sends have completed
     waitStart = SST::Core::Profile::now();
-    MPI_Waitall(sreq_count, sreqs.get(), MPI_STATUSES_IGNORE);
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        i->second.send_buffer.wait();
+    }
     mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
 
     for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
@@ -272,68 +274,35 @@ RankSyncSerialSkip::exchangeLinkUntimedData(int UNUSED_WO_MPI(thread), std::atom
     if ( thread != 0 ) {
         return;
     }
-    // Maximum number of outstanding requests is 3 times the number of
-    // ranks I communicate with (1 recv, 2 sends per rank)
-    auto sreqs      = std::make_unique<MPI_Request[]>(2 * comm_map.size());
-    auto rreqs      = std::make_unique<MPI_Request[]>(comm_map.size());
-    int  rreq_count = 0;
-    int  sreq_count = 0;
-
     for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
 
         // Do all the sends
         // Get the buffer from the syncQueue
-        char*                  send_buffer = i->second.squeue->getData();
-        // Cast to Header so we can get/fill in data
-        RankSyncQueue::Header* hdr         = reinterpret_cast<RankSyncQueue::Header*>(send_buffer);
-        int                    tag         = 1;
-        // Check to see if remote queue is big enough for data
-        if ( i->second.remote_size < hdr->buffer_size ) {
-            // not big enough, send message that will tell remote side to get larger buffer
-            hdr->mode = 1;
-            MPI_Isend(send_buffer, sizeof(RankSyncQueue::Header), MPI_BYTE, i->first /*dest*/, tag, MPI_COMM_WORLD,
-                &sreqs[sreq_count++]);
-            i->second.remote_size = hdr->buffer_size;
-            tag                   = 2;
-        }
-        else {
-            hdr->mode = 0;
-        }
-        MPI_Isend(
-            send_buffer, hdr->buffer_size, MPI_BYTE, i->first /*dest*/, tag, MPI_COMM_WORLD, &sreqs[sreq_count++]);
+        char* send_buffer = i->second.squeue->getData();
+        i->second.send_buffer.start(send_buffer);
 
         // Post all the receives
-        MPI_Irecv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 1, MPI_COMM_WORLD, &rreqs[rreq_count++]);
+        i->second.recv_buffer.start();
     }
 
     // Wait for all recvs to complete
-    MPI_Waitall(rreq_count, rreqs.get(), MPI_STATUSES_IGNORE);
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        i->second.recv_buffer.wait();
+    }
 
     for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
 
         // Get the buffer and deserialize all the events
-        char* buffer = i->second.rbuf;
+        char* buffer = i->second.recv_buffer.complete();
 
         RankSyncQueue::Header* hdr  = reinterpret_cast<RankSyncQueue::Header*>(buffer);
         unsigned int           size = hdr->buffer_size;
-        int                    mode = hdr->mode;
-
-        if ( mode == 1 ) {
-            // May need to resize the buffer
-            if ( size > i->second.local_size ) {
-                delete[] i->second.rbuf;
-                i->second.rbuf       = new char[size];
-                i->second.local_size = size;
-            }
-            MPI_Recv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 2, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-            buffer = i->second.rbuf;
-        }
 
         SST::Core::Serialization::serializer ser;
         ser.start_unpacking(&buffer[sizeof(RankSyncQueue::Header)], size - sizeof(RankSyncQueue::Header));
 
         std::vector<Activity*> activities;
-        SST_SER(activities);
+        RankSyncQueue::serializeEvents(ser, activities);
         for ( unsigned int j = 0; j < activities.size(); j++ ) {
 
             Event* ev = static_cast<Event*>(activities[j]);
@@ -342,7 +311,9 @@ RankSyncSerialSkip::exchangeLinkUntimedData(int UNUSED_WO_MPI(thread), std::atom
     }
 
     // Clear the RankSyncQueues used to send the data after all the sends have completed
-    MPI_Waitall(sreq_count, sreqs.get(), MPI_STATUSES_IGNORE);
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        i->second.send_buffer.wait();
+    }
 
     for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
         i->second.squeue->clear();
@@ -13,6 +13,8 @@
 #define SST_CORE_SYNC_RANKSYNCSERIALSKIP_H
 
 #include "sst/core/sst_types.h"
+#include "sst/core/sync/rankSyncBuffers.h"
+#include "sst/core/sync/rankSyncSharedMemory.h"
 #include "sst/core/sync/syncManager.h"
 #include "sst/core/threadsafe.h"
 
@@ -57,17 +59,20 @@ public:
     uint64_t getDataSize() const override;
 
 private:
-    static SimTime_t myNextSyncTime;
-
     // Function that actually does the exchange during run
     void exchange();
 
+protected:
+    static SimTime_t myNextSyncTime;
+
     struct comm_pair : public SST::Core::Serialization::serializable
     {
-        RankSyncQueue* squeue; // RankSyncQueue
-        char*          rbuf;   // receive buffer
-        uint32_t       local_size;
-        uint32_t       remote_size;
+        RankSyncQueue*     squeue; // RankSyncQueue
+        RankSyncSendBuffer send_buffer;
+        RankSyncRecvBuffer recv_buffer;
+        // Shared memory channels, or -1 if the rank is on another node
+        int                shm_send = -1;
+        int                shm_recv = -1;
 
         void serialize_order(SST::Core::Serialization::serializer& UNUSED(ser)) override {}
         ImplementSerializable(comm_pair)
@@ -81,8 +86,12 @@ private:
     link_map_t link_map;
 
     double mpiWaitTime;
+    double serializeTime;
     double deserializeTime;
 
+    // Used for the ranks on this node with --rank-sync-shmem
+    RankSyncSharedMemory shm_;
+
     Core::ThreadSafe::Spinlock lock;
     static int                 sig_end_;
     static int                 sig_usr_;
@@ -0,0 +1,250 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/sync/rankSyncSharedMemory.h"
+
+#include "sst/core/output.h"
+#include "sst/core/sync/rankSyncBuffers.h"
+#include "sst/core/sync/syncQueue.h"
+#include "sst/core/threadsafe.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+#include <sched.h>
+#include <sys/mman.h>
+
+namespace SST {
+
+namespace {
+
+// Sent to each rank on the node to tell it where the rings it sends
+// on are
+struct ConnectInfo
+{
+    char     region_name[128];
+    uint32_t first_ring;
+    uint32_t num_rings;
+};
+
+} // namespace
+
+RankSyncSharedMemory::~RankSyncSharedMemory()
+{
+    for ( auto& [rank, tunnel] : remote_tunnels_ ) {
+        delete tunnel;
+    }
+    delete tunnel_;
+}
+
+void
+RankSyncSharedMemory::init()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank_);
+    MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, rank_, MPI_INFO_NULL, &node_comm_);
+
+    int node_size;
+    MPI_Comm_size(node_comm_, &node_size);
+    std::vector<int> world_ranks(node_size);
+    MPI_Allgather(&rank_, 1, MPI_INT, world_ranks.data(), 1, MPI_INT, node_comm_);
+    for ( int i = 0; i < node_size; i++ ) {
+        node_ranks_[world_ranks[i]] = i;
+    }
+#endif
+}
+
+bool
+RankSyncSharedMemory::isLocal(int rank) const
+{
+    return rank != rank_ && node_ranks_.count(rank) != 0;
+}
+
+int
+RankSyncSharedMemory::addSend(int rank, uint32_t thread)
+{
+    SendChannel channel;
+    channel.rank   = rank;
+    channel.thread = thread;
+    sends_.push_back(channel);
+    return sends_.size() - 1;
+}
+
+int
+RankSyncSharedMemory::addRecv(int rank, uint32_t thread, RankSyncRecvBuffer* buffer)
+{
+    RecvChannel channel;
+    channel.rank   = rank;
+    channel.thread = thread;
+    channel.buffer = buffer;
+    recvs_.push_back(channel);
+    return recvs_.size() - 1;
+}
+
+void
+RankSyncSharedMemory::connect()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    // Both sides order the channels between two ranks by the thread
+    // on the receiving rank, so the sender can find its rings from
+    // the first one and the count
+    auto by_thread = [](std::map<int, std::vector<uint32_t>>& channels, auto& list) {
+        for ( auto& [rank, ids] : channels ) {
+            std::sort(ids.begin(), ids.end(), [&](uint32_t a, uint32_t b) { return list[a].thread < list[b].thread; });
+        }
+    };
+
+    std::map<int, std::vector<uint32_t>> recv_channels;
+    for ( uint32_t i = 0; i < recvs_.size(); i++ ) {
+        recv_channels[recvs_[i].rank].push_back(i);
+    }
+    by_thread(recv_channels, recvs_);
+
+    std::map<int, std::vector<uint32_t>> send_channels;
+    for ( uint32_t i = 0; i < sends_.size(); i++ ) {
+        send_channels[sends_[i].rank].push_back(i);
+    }
+    by_thread(send_channels, sends_);
+
+    std::vector<ConnectInfo> infos(recv_channels.size());
+    std::vector<MPI_Request> reqs(recv_channels.size());
+    if ( !recvs_.empty() ) {
+        tunnel_ = new Tunnel(rank_, recvs_.size(), RING_SIZE, recv_channels.size());
+        tunnel_->getSharedData()->rank = rank_;
+
+        const std::string& name = tunnel_->getRegionName();
+        if ( name.size() >= sizeof(ConnectInfo::region_name) ) {
+            Output::getDefaultObject().fatal(
+                CALL_INFO, 1, "Shared memory region name '%s' is too long\n", name.c_str());
+        }
+
+        uint32_t ring = 0;
+        int      req  = 0;
+        for ( auto& [rank, ids] : recv_channels ) {
+            ConnectInfo& info = infos[req];
+            memset(&info, 0, sizeof(info));
+            strncpy(info.region_name, name.c_str(), sizeof(info.region_name) - 1);
+            info.first_ring = ring;
+            info.num_rings  = ids.size();
+            for ( auto id : ids ) {
+                recvs_[id].ring = ring++;
+            }
+            MPI_Isend(&info, sizeof(info), MPI_BYTE, node_ranks_[rank], 0, node_comm_, &reqs[req++]);
+        }
+    }
+
+    for ( auto& [rank, ids] : send_channels ) {
+        ConnectInfo info;
+        MPI_Recv(&info, sizeof(info), MPI_BYTE, node_ranks_[rank], 0, node_comm_, MPI_STATUS_IGNORE);
+        if ( info.num_rings != ids.size() ) {
+            Output::getDefaultObject().fatal(CALL_INFO, 1,
+                "Rank %d has %" PRIu32 " shared memory channels from rank %d, but %zu were expected\n", rank,
+                info.num_rings, rank_, ids.size());
+        }
+
+        Tunnel* tunnel        = new Tunnel(std::string(info.region_name));
+        remote_tunnels_[rank] = tunnel;
+        uint32_t ring         = info.first_ring;
+        for ( auto id : ids ) {
+            sends_[id].tunnel = tunnel;
+            sends_[id].ring   = ring++;
+        }
+    }
+    MPI_Waitall(reqs.size(), reqs.data(), MPI_STATUSES_IGNORE);
+
+    // The last rank to attach removes the name of the region, but
+    // make sure it is gone once everyone is attached
+    MPI_Barrier(node_comm_);
+    if ( tunnel_ != nullptr ) shm_unlink(tunnel_->getRegionName().c_str());
+
+    // Only needed to set up the rings
+    MPI_Comm_free(&node_comm_);
+#endif
+}
+
+void
+RankSyncSharedMemory::startSend(int channel, const char* buffer)
+{
+    SendChannel& send = sends_[channel];
+    send.buffer       = buffer;
+    send.size         = reinterpret_cast<const RankSyncQueue::Header*>(buffer)->buffer_size;
+    send.offset       = 0;
+    send.active       = true;
+}
+
+void
+RankSyncSharedMemory::startRecv(int channel)
+{
+    RecvChannel& recv = recvs_[channel];
+    recv.size         = 0;
+    recv.offset       = 0;
+    recv.active       = true;
+}
+
+bool
+RankSyncSharedMemory::progress()
+{
+    bool done = true;
+
+    // Chunks are copied straight between the message buffers and the
+    // ring slots
+    for ( auto& send : sends_ ) {
+        uint32_t count = 0;
+        auto     fill  = [&](Chunk& chunk) { memcpy(chunk.data, send.buffer + send.offset, count); };
+        while ( send.active ) {
+            count = std::min<uint32_t>(CHUNK_SIZE, send.size - send.offset);
+            if ( !send.tunnel->writeMessageInPlaceNB(send.ring, fill) ) break;
+
+            send.offset += count;
+            if ( send.offset == send.size ) send.active = false;
+        }
+        done = done && !send.active;
+    }
+
+    for ( auto& recv : recvs_ ) {
+        auto drain = [&](const Chunk& chunk) {
+            // The first chunk starts with the header, which has the
+            // size of the whole message
+            if ( recv.offset == 0 ) {
+                recv.size = reinterpret_cast<const RankSyncQueue::Header*>(chunk.data)->buffer_size;
+                recv.buffer->reserve(recv.size);
+            }
+
+            uint32_t count = std::min<uint32_t>(CHUNK_SIZE, recv.size - recv.offset);
+            memcpy(recv.buffer->getBuffer() + recv.offset, chunk.data, count);
+            recv.offset += count;
+        };
+        while ( recv.active && tunnel_->readMessageInPlaceNB(recv.ring, drain) ) {
+            if ( recv.offset == recv.size ) recv.active = false;
+        }
+        done = done && !recv.active;
+    }
+
+    return done;
+}
+
+void
+RankSyncSharedMemory::wait()
+{
+    // Ranks may share cores, so give up the core if the other side
+    // isn't ready
+    int loop_counter = 0;
+    while ( !progress() ) {
+        if ( loop_counter++ < 64 )
+            sst_pause();
+        else
+            sched_yield();
+    }
+}
+
+} // namespace SST
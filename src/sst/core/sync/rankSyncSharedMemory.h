@@ -0,0 +1,153 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_SYNC_RANKSYNCSHAREDMEMORY_H
+#define SST_CORE_SYNC_RANKSYNCSHAREDMEMORY_H
+
+#include "sst/core/interprocess/ipctunnel.h"
+#include "sst/core/sst_mpi.h"
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace SST {
+
+class RankSyncRecvBuffer;
+
+/**
+   Moves the RankSyncQueue buffers between ranks on the same node
+   through shared memory instead of MPI.
+
+   Each rank creates an IPCTunnel with one ring for every channel it
+   receives on from another rank on the node, and attaches to the
+   tunnels of the ranks it sends to.  A channel carries the messages
+   from one rank to one thread of another rank, so the serial syncs
+   use thread 0 and the parallel sync uses one channel per thread
+   pair.  Messages are split into fixed size chunks, so a message
+   larger than a ring is streamed through it as the receiver reads.
+
+   Sends and receives are started for each sync, then progress() is
+   called until they are all done.  It never blocks, so it can be
+   mixed with MPI transfers to the ranks on other nodes.
+ */
+class RankSyncSharedMemory
+{
+public:
+    RankSyncSharedMemory() = default;
+    ~RankSyncSharedMemory();
+
+    RankSyncSharedMemory(const RankSyncSharedMemory&)            = delete;
+    RankSyncSharedMemory& operator=(const RankSyncSharedMemory&) = delete;
+
+    /** Find the ranks that share this node.  Must be called by all
+     * ranks. */
+    void init();
+
+    /** Returns true if rank is another rank on this node */
+    bool isLocal(int rank) const;
+
+    /** Add a channel to send to thread of rank.  Returns the id of
+     * the channel. */
+    int addSend(int rank, uint32_t thread);
+
+    /** Add a channel to receive from rank into buffer for the local
+     * thread.  Returns the id of the channel. */
+    int addRecv(int rank, uint32_t thread, RankSyncRecvBuffer* buffer);
+
+    /** Create the rings and attach to the ones on the other ranks.
+     * Must be called by all ranks on the node after all the channels
+     * are added. */
+    void connect();
+
+    /** Start sending buffer, which must come from
+     * RankSyncQueue::getData().  It can't be changed until the send
+     * is done. */
+    void startSend(int channel, const char* buffer);
+
+    /** Start receiving on channel */
+    void startRecv(int channel);
+
+    /** Move as much data as the rings allow without waiting.  Returns
+     * true when all the started sends and receives are done. */
+    bool progress();
+
+    /** Call progress() until all the started sends and receives are
+     * done */
+    void wait();
+
+    /** Returns true if the last receive started on channel is done */
+    bool isRecvDone(int channel) const { return !recvs_[channel].active; }
+
+    /** Number of ranks on this node, including this one */
+    int getNodeSize() const { return static_cast<int>(node_ranks_.size()); }
+
+private:
+    // Size of the chunks the messages are split into
+    static constexpr size_t CHUNK_SIZE = 4096;
+    // Number of chunks in each ring
+    static constexpr size_t RING_SIZE  = 64;
+
+    struct Chunk
+    {
+        char data[CHUNK_SIZE];
+    };
+
+    struct TunnelInfo
+    {
+        int32_t rank;
+    };
+
+    using Tunnel = Core::Interprocess::IPCTunnel<TunnelInfo, Chunk>;
+
+    struct SendChannel
+    {
+        int         rank;
+        uint32_t    thread;
+        Tunnel*     tunnel = nullptr;
+        size_t      ring   = 0;
+        const char* buffer = nullptr;
+        uint32_t    size   = 0;
+        uint32_t    offset = 0;
+        bool        active = false;
+    };
+
+    struct RecvChannel
+    {
+        int                 rank;
+        uint32_t            thread;
+        RankSyncRecvBuffer* buffer;
+        size_t              ring   = 0;
+        uint32_t            size   = 0;
+        uint32_t            offset = 0;
+        bool                active = false;
+    };
+
+    int rank_ = 0;
+
+#ifdef SST_CONFIG_HAVE_MPI
+    MPI_Comm node_comm_ = MPI_COMM_NULL;
+#endif
+    // Rank on the node for each rank on the node
+    std::map<int, int> node_ranks_;
+
+    std::vector<SendChannel> sends_;
+    std::vector<RecvChannel> recvs_;
+
+    // Tunnel holding the rings this rank receives on, and the
+    // tunnels of the ranks it sends to
+    Tunnel*                 tunnel_ = nullptr;
+    std::map<int, Tunnel*>  remote_tunnels_;
+};
+
+} // namespace SST
+
+#endif // SST_CORE_SYNC_RANKSYNCSHAREDMEMORY_H
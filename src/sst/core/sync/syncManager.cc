@@ -20,7 +20,10 @@
 #include "sst/core/realtime.h"
 #include "sst/core/simulation_impl.h"
 #include "sst/core/sst_mpi.h"
+#include "sst/core/sync/rankSyncLookahead.h"
+#include "sst/core/sync/rankSyncNeighbor.h"
 #include "sst/core/sync/rankSyncParallelSkip.h"
+#include "sst/core/sync/rankSyncPipelined.h"
 #include "sst/core/sync/rankSyncSerialSkip.h"
 #include "sst/core/sync/syncQueue.h"
 #include "sst/core/sync/threadSyncDirectSkip.h"
@@ -241,6 +244,12 @@ RankSync::exchangeLinkInfo(uint32_t UNUSED_WO_MPI(my_rank))
 #endif
 }
 
+void
+RankSync::checkExit(Exit* exit)
+{
+    exit->check();
+}
+
 // Class used to hold the list of profile tools installed in the SyncManager
 class SyncProfileToolList
 {
@@ -281,7 +290,14 @@ SyncManager::setupSyncObjects()
         }
         if ( min_part_ != MAX_SIMTIME_T ) {
             if ( num_ranks_.thread == 1 ) {
-                rankSync_ = new RankSyncSerialSkip(num_ranks_);
+                if ( sim_->rank_sync == "lookahead" )
+                    rankSync_ = new RankSyncLookahead(num_ranks_);
+                else if ( sim_->rank_sync == "neighbor" )
+                    rankSync_ = new RankSyncNeighbor(num_ranks_);
+                else if ( sim_->rank_sync == "pipelined" )
+                    rankSync_ = new RankSyncPipelined(num_ranks_);
+                else
+                    rankSync_ = new RankSyncSerialSkip(num_ranks_);
             }
             else {
                 rankSync_ = new RankSyncParallelSkip(num_ranks_);
@@ -298,7 +314,8 @@ SyncManager::setupSyncObjects()
     SimTime_t interthread_minlat = sim_->getInterThreadMinLatency();
     if ( num_ranks_.thread > 1 && interthread_minlat != MAX_SIMTIME_T ) {
         if ( sim_->direct_interthread ) {
-            threadSync_ = new ThreadSyncDirectSkip(num_ranks_.thread, rank_.thread, sim_);
+            threadSync_ = new ThreadSyncDirectSkip(
+                num_ranks_.thread, rank_.thread, min_part_, sim_->interthread_channels, sim_);
         }
         else {
             threadSync_ = new ThreadSyncSimpleSkip(num_ranks_.thread, rank_.thread, sim_);
@@ -431,7 +448,7 @@ SyncManager::execute()
         // checkpoint happened and the last thing that happens in the
         // checkpoint code is a barrier.
 
-        if ( exit_ != nullptr && rank_.thread == 0 ) exit_->check();
+        if ( exit_ != nullptr && rank_.thread == 0 ) rankSync_->checkExit(exit_);
 
         RankExecBarrier_[3].wait();
 
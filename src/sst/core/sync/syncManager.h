@@ -17,6 +17,7 @@
 #include "sst/core/rankInfo.h"
 #include "sst/core/sst_types.h"
 #include "sst/core/threadsafe.h"
+#include "sst/core/warnmacros.h"
 
 #include <cstdint>
 #include <map>
@@ -65,6 +66,10 @@ public:
     /** Return exchanged signals after sync */
     virtual bool getSignals(int& end, int& usr, int& alrm) = 0;
 
+    /** Check whether the simulation should end.  Called on thread
+     * 0 after each sync */
+    virtual void checkExit(Exit* exit);
+
     virtual SimTime_t getNextSyncTime() { return nextSyncTime; }
 
     virtual void setRestartTime(SimTime_t time) { nextSyncTime = time; }
@@ -89,6 +94,17 @@ protected:
     inline void setLinkDeliveryInfo(Link* link, uintptr_t info) { link->pair_link->setDeliveryInfo(info); }
 
     inline Link* getDeliveryLink(Event* ev) { return ev->getDeliveryLink(); }
+
+    /** Minimum latency of events sent to the remote rank on a
+     * registered link */
+    inline SimTime_t getSendLatency(Link* link) { return link->pair_link->latency; }
+
+    /** Send received events on their delivery links.  The contents of
+     * events are overwritten, so it should be cleared afterwards. */
+    inline void sendEvents_sync(std::vector<Activity*>& events)
+    {
+        Link::sendBatch_sync(events.data(), events.size());
+    }
 };
 
 class ThreadSync
@@ -119,6 +135,11 @@ public:
     virtual void           registerLink(const std::string& name, Link* link)                = 0;
     virtual ActivityQueue* registerRemoteLink(int tid, const std::string& name, Link* link) = 0;
 
+    /** Register a direct interthread Link owned by this thread whose
+     * pair is on thread remote_thread.  Only used by ThreadSyncs that
+     * handle direct interthread links. */
+    virtual void registerDirectLink(Link* UNUSED(link), int UNUSED(remote_thread)) {}
+
 protected:
     SimTime_t     nextSyncTime;
     TimeConverter max_period;
@@ -131,7 +152,23 @@ protected:
 
     inline void setLinkDeliveryInfo(Link* link, uintptr_t info) { link->pair_link->setDeliveryInfo(info); }
 
+    inline SimTime_t getLinkLatency(Link* link) { return link->latency; }
+
+    /** Set the queue that events sent on link are inserted into.
+     * Links whose pair is a polling link keep their PollingLinkQueue. */
+    inline void setLinkSendQueue(Link* link, ActivityQueue* queue)
+    {
+        if ( Link::HANDLER == link->pair_link->type ) link->send_queue = queue;
+    }
+
     inline Link* getDeliveryLink(Event* ev) { return ev->getDeliveryLink(); }
+
+    /** Send received events on their delivery links.  The contents of
+     * events are overwritten, so it should be cleared afterwards. */
+    inline void sendEvents_sync(std::vector<Activity*>& events)
+    {
+        Link::sendBatch_sync(events.data(), events.size());
+    }
 };
 
 class SyncManager : public Action
@@ -145,6 +182,11 @@ public:
     /** Register a Link which this Sync Object is responsible for */
     ActivityQueue* registerLink(
         const RankInfo& to_rank, const RankInfo& from_rank, const std::string& name, Link* link);
+    /** Register a direct interthread Link owned by this thread */
+    void registerDirectLink(Link* link, const RankInfo& remote_rank)
+    {
+        threadSync_->registerDirectLink(link, remote_rank.thread);
+    }
     void exchangeLinkInfo();
     void execute() override;
 
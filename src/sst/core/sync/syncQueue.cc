@@ -61,6 +61,13 @@ RankSyncQueue::insert(Activity* activity)
     activities.push_back(activity);
 }
 
+void
+RankSyncQueue::insertBatch(Activity** begin, size_t n)
+{
+    std::lock_guard<Spinlock> lock(slock);
+    activities.insert(activities.end(), begin, begin + n);
+}
+
 Activity*
 RankSyncQueue::pop()
 {
@@ -87,6 +94,18 @@ RankSyncQueue::clear()
     activities.clear();
 }
 
+SimTime_t
+RankSyncQueue::getMinDeliveryTime()
+{
+    std::lock_guard<Spinlock> lock(slock);
+
+    SimTime_t min_time = MAX_SIMTIME_T;
+    for ( auto* activity : activities ) {
+        if ( activity->getDeliveryTime() < min_time ) min_time = activity->getDeliveryTime();
+    }
+    return min_time;
+}
+
 char*
 RankSyncQueue::getData()
 {
@@ -96,7 +115,7 @@ RankSyncQueue::getData()
 
     ser.start_sizing();
 
-    SST_SER(activities);
+    serializeEvents(ser, activities);
 
     size_t size = ser.size();
 
@@ -107,13 +126,19 @@ RankSyncQueue::getData()
             delete[] buffer;
         }
 
-        buf_size = size + sizeof(RankSyncQueue::Header);
+        // Grow by powers of two, so the buffer is rarely reallocated
+        // and RankSyncSendBuffer can send it in power of two sizes
+        size_t new_size = buf_size != 0 ? buf_size : 4096;
+        while ( new_size < (size + sizeof(RankSyncQueue::Header)) )
+            new_size *= 2;
+
+        buf_size = new_size;
         buffer   = new char[buf_size];
     }
 
     ser.start_packing(buffer + sizeof(RankSyncQueue::Header), size);
 
-    SST_SER(activities);
+    serializeEvents(ser, activities);
 
     // Delete all the events
     for ( unsigned int i = 0; i < activities.size(); i++ ) {
@@ -127,4 +152,69 @@ RankSyncQueue::getData()
     return buffer;
 }
 
+void
+RankSyncQueue::serializeEvents(serializer& ser, std::vector<Activity*>& activities)
+{
+    // Trivially relocatable events are sent as their class id followed
+    // by everything in the object after the vtable pointer.  On the
+    // receiving side the object is created by the serialization
+    // factory, which allocates it from the MemPool for its size and
+    // gives it the local vtable, and the rest is copied over it.
+    // Other events are sent with an id of 0 followed by the normal
+    // polymorphic serialization.
+    constexpr size_t vptr_size = sizeof(void*);
+
+    size_t count = activities.size();
+    SST_SER(count);
+
+    if ( ser.mode() == serializer::UNPACK ) {
+        activities.reserve(activities.size() + count);
+        for ( size_t i = 0; i < count; i++ ) {
+            uint32_t id = 0;
+            SST_SER(id);
+            Activity* activity = nullptr;
+            if ( id != 0 ) {
+                Event* event = static_cast<Event*>(Core::Serialization::serializable_factory::get_serializable(id));
+                ser.raw(reinterpret_cast<char*>(event) + vptr_size, event->getTriviallyRelocatableSize() - vptr_size);
+                activity = event;
+            }
+            else {
+                SST_SER(activity);
+            }
+            activities.push_back(activity);
+        }
+        return;
+    }
+
+    for ( auto* activity : activities ) {
+        Event*   event = static_cast<Event*>(activity);
+        size_t   size  = event->getTriviallyRelocatableSize();
+        uint32_t id    = size != 0 ? event->cls_id() : 0;
+        SST_SER(id);
+        if ( id != 0 ) {
+            ser.raw(reinterpret_cast<char*>(event) + vptr_size, size - vptr_size);
+        }
+        else {
+            SST_SER(activity);
+        }
+    }
+}
+
+ThreadChannelQueue::~ThreadChannelQueue()
+{
+    // Anything left in the channel was never delivered
+    channel.remove_all(scratch);
+    for ( auto* activity : scratch ) {
+        delete activity;
+    }
+}
+
+void
+ThreadChannelQueue::drainInto(ActivityQueue* queue)
+{
+    if ( channel.remove_all(scratch) == 0 ) return;
+    queue->insertBatch(scratch.data(), scratch.size());
+    scratch.clear();
+}
+
 } // namespace SST
@@ -14,6 +14,8 @@
 
 #include "sst/core/activityQueue.h"
 #include "sst/core/rankInfo.h"
+#include "sst/core/serialization/serializer_fwd.h"
+#include "sst/core/sst_types.h"
 #include "sst/core/threadsafe.h"
 
 #include <cstddef>
@@ -60,6 +62,14 @@ public:
         uint32_t mode;
         uint32_t count;
         uint32_t buffer_size;
+        // Receive buffer size to use, set by RankSyncSendBuffer
+        uint32_t recv_size;
+
+        // Only used by RankSyncLookahead
+        uint32_t  status;
+        uint32_t  signals;
+        SimTime_t time;
+        SimTime_t end_time;
     };
 
     explicit RankSyncQueue(RankInfo to_rank);
@@ -68,14 +78,27 @@ public:
     bool      empty() override;
     int       size() override;
     void      insert(Activity* activity) override;
+    void      insertBatch(Activity** begin, size_t n) override;
     Activity* pop() override; // Not a good idea for this particular class
     Activity* front() override;
 
     // Not part of the ActivityQueue interface
     /** Clear elements from the queue */
     void  clear();
-    /** Accessor method to the internal queue */
+    /** Accessor method to the internal queue.  The buffer size is
+     * always a power of two. */
     char* getData();
+    /** Earliest delivery time of the events in the queue, or
+     * MAX_SIMTIME_T if it is empty.  Must be called before getData() */
+    SimTime_t getMinDeliveryTime();
+
+    /**
+       Serializes or deserializes the events in a sync buffer.  Events
+       declared with ImplementTriviallyRelocatableEvent() are copied
+       as raw bytes, all others go through the serializer.  When
+       unpacking, the events are appended to activities.
+     */
+    static void serializeEvents(Core::Serialization::serializer& ser, std::vector<Activity*>& activities);
 
     uint64_t getDataSize() { return buf_size + (activities.capacity() * sizeof(Activity*)); }
 
@@ -111,6 +134,9 @@ public:
     /** Insert a new activity into the queue */
     void insert(Activity* activity) override { activities.push_back(activity); }
 
+    /** Insert a set of activities into the queue */
+    void insertBatch(Activity** begin, size_t n) override { activities.insert(activities.end(), begin, begin + n); }
+
     /** Not supported */
     Activity* front() override
     {
@@ -126,6 +152,48 @@ private:
     std::vector<Activity*> activities;
 };
 
+/**
+   Activity Queue used by direct interthread links.  There is one of
+   these for each (sending thread, receiving thread) pair.  The sending
+   thread inserts without taking a lock and the receiving thread moves
+   the activities into its TimeVortex during its sync, so the
+   TimeVortex itself is only ever touched by its own thread.
+ */
+class ThreadChannelQueue : public SyncQueue
+{
+public:
+    explicit ThreadChannelQueue(RankInfo to_rank) :
+        SyncQueue(to_rank)
+    {}
+    ~ThreadChannelQueue();
+
+    /** Returns true if the queue is empty.  Receiving thread only. */
+    bool empty() override { return channel.empty(); }
+
+    /** Not supported */
+    int size() override { return 0; }
+
+    /** Not supported */
+    Activity* pop() override { return nullptr; }
+
+    /** Not supported */
+    Activity* front() override { return nullptr; }
+
+    /** Insert a new activity into the queue.  Sending thread only. */
+    void insert(Activity* activity) override { channel.insert(activity); }
+
+    /** Insert a set of activities into the queue.  Sending thread only. */
+    void insertBatch(Activity** begin, size_t n) override { channel.insert(begin, n); }
+
+    /** Move all the activities in the channel into queue.  Receiving
+     * thread only. */
+    void drainInto(ActivityQueue* queue);
+
+private:
+    Core::ThreadSafe::SPSCQueue<Activity*> channel;
+    std::vector<Activity*>                 scratch;
+};
+
 } // namespace SST
 
 #endif // SST_CORE_SYNC_SYNCQUEUE_H
@@ -18,19 +18,27 @@
 #include "sst/core/link.h"
 #include "sst/core/simulation_impl.h"
 #include "sst/core/timeConverter.h"
+#include "sst/core/timeVortex.h"
 #include "sst/core/warnmacros.h"
 
+#include <algorithm>
+#include <mutex>
+#include <thread>
+
 namespace SST {
 
 SimTime_t ThreadSyncDirectSkip::localMinimumNextActivityTime = 0;
 
 /** Create a new ThreadSyncDirectSkip object */
-ThreadSyncDirectSkip::ThreadSyncDirectSkip(int num_threads, int thread, Simulation_impl* sim) :
+ThreadSyncDirectSkip::ThreadSyncDirectSkip(
+    int num_threads, int thread, SimTime_t min_part, bool use_channels, Simulation_impl* sim) :
     ThreadSync(),
     num_threads(num_threads),
     thread(thread),
     sim(sim),
-    totalWaitTime(0.0)
+    totalWaitTime(0.0),
+    use_channels(use_channels),
+    progress(0)
 {
     if ( sim->getRank().thread == 0 ) {
         barrier[0].resize(num_threads);
@@ -43,8 +51,24 @@ ThreadSyncDirectSkip::ThreadSyncDirectSkip(int num_threads, int thread, Simulati
     else
         single_rank = true;
 
+    // On single rank runs SyncManager exchanges signals and checks
+    // for checkpoints after the thread sync, and with no rank links
+    // it checks the exit refcount.  Those need every thread to be
+    // done with the period, so keep the barrier for them.
+    need_barrier = single_rank || min_part == MAX_SIMTIME_T;
+
     my_max_period = sim->getInterThreadMinLatency();
     nextSyncTime  = my_max_period;
+
+    RankInfo rank = sim->getRank();
+    for ( int i = 0; i < num_threads; i++ ) {
+        channels.push_back(i == thread || !use_channels ? nullptr : new ThreadChannelQueue(rank));
+    }
+    channel_lookahead.resize(num_threads, MAX_SIMTIME_T);
+
+    std::lock_guard<Core::ThreadSafe::Spinlock> lock(instances_lock);
+    if ( instances.size() < static_cast<size_t>(num_threads) ) instances.resize(num_threads, nullptr);
+    instances[thread] = this;
 }
 
 ThreadSyncDirectSkip::~ThreadSyncDirectSkip()
@@ -52,6 +76,79 @@ ThreadSyncDirectSkip::~ThreadSyncDirectSkip()
     if ( totalWaitTime > 0.0 )
         Output::getDefaultObject().verbose(
             CALL_INFO, 1, 0, "ThreadSyncDirectSkip total wait time: %lg seconds.\n", totalWaitTime);
+    for ( auto* channel : channels ) {
+        delete channel;
+    }
+    channels.clear();
+}
+
+void
+ThreadSyncDirectSkip::registerDirectLink(Link* link, int remote_thread)
+{
+    // Without channels the link keeps sending to the remote TimeVortex
+    if ( !use_channels ) return;
+    direct_links.emplace_back(link, remote_thread);
+}
+
+void
+ThreadSyncDirectSkip::finalizeLinkConfigurations()
+{
+    // The thread that owns the pair link points our link at its
+    // TimeVortex in Link::finalizeConfiguration().  Wait for all
+    // threads to get through that, then point the links at the
+    // channel to the pair's thread instead.
+    barrier[0].wait();
+    for ( auto& [link, remote_thread] : direct_links ) {
+        ThreadSyncDirectSkip* remote = instances[remote_thread];
+        setLinkSendQueue(link, remote->channels[thread]);
+
+        // Only this thread writes its entry in the remote lookaheads
+        SimTime_t& lookahead = remote->channel_lookahead[thread];
+        lookahead            = std::min(lookahead, getLinkLatency(link));
+    }
+    direct_links.clear();
+
+    // Make the lookaheads visible to their owners
+    barrier[1].wait();
+}
+
+void
+ThreadSyncDirectSkip::waitForProgress(int sender, SimTime_t needed)
+{
+    std::atomic<SimTime_t>& remote = instances[sender]->progress;
+    if ( remote.load(std::memory_order_acquire) >= needed ) return;
+
+    auto     start = Core::Profile::now();
+    uint32_t count = 0;
+    while ( remote.load(std::memory_order_acquire) < needed ) {
+        if ( count++ < 1024 )
+            sst_pause();
+        else
+            std::this_thread::yield();
+    }
+    totalWaitTime += Core::Profile::getElapsed(start);
+}
+
+void
+ThreadSyncDirectSkip::before()
+{
+    // Everything we sent before this point is in the other threads'
+    // channels
+    SimTime_t now = sim->getCurrentSimCycle();
+    progress.store(now, std::memory_order_release);
+
+    // Move events sent to us by the other threads into our TimeVortex.
+    // Events sent on a channel at or after the sender's progress
+    // arrive at least the channel's lookahead later, so once the
+    // sender is far enough along, anything still to come is for a
+    // later period.
+    SimTime_t      horizon = now + my_max_period;
+    ActivityQueue* queue   = sim->getTimeVortex();
+    for ( int i = 0; i < num_threads; i++ ) {
+        if ( !channels[i] || channel_lookahead[i] == MAX_SIMTIME_T ) continue;
+        if ( channel_lookahead[i] < horizon ) waitForProgress(i, horizon - channel_lookahead[i]);
+        channels[i]->drainInto(queue);
+    }
 }
 
 void
@@ -73,8 +170,12 @@ ThreadSyncDirectSkip::after()
 void
 ThreadSyncDirectSkip::execute()
 {
+    // Each channel is only waited on as long as its sender needs to
+    // catch up, so there is no barrier across all threads here unless
+    // SyncManager is going to look at shared state after the sync.
+    before();
     after();
-    totalWaitTime += barrier[2].wait();
+    if ( need_barrier ) totalWaitTime += barrier[2].wait();
 }
 
 uint64_t
@@ -107,5 +208,8 @@ int                       ThreadSyncDirectSkip::sig_end_(0);
 int                       ThreadSyncDirectSkip::sig_usr_(0);
 int                       ThreadSyncDirectSkip::sig_alrm_(0);
 
+std::vector<ThreadSyncDirectSkip*> ThreadSyncDirectSkip::instances;
+Core::ThreadSafe::Spinlock         ThreadSyncDirectSkip::instances_lock;
+
 
 } // namespace SST
@@ -17,9 +17,12 @@
 #include "sst/core/sync/syncManager.h"
 #include "sst/core/sync/syncQueue.h"
 
+#include <atomic>
 #include <cstdint>
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace SST {
 
@@ -30,25 +33,39 @@ class Exit;
 class Event;
 class Simulation_impl;
 class ThreadSyncQueue;
-
+class ThreadChannelQueue;
+
+/**
+   ThreadSync used with direct interthread links.  Events sent on a
+   direct interthread link go into a lock-free channel dedicated to
+   the (sending thread, receiving thread) pair.  Each thread drains its
+   incoming channels into its own TimeVortex during its sync.  Instead
+   of waiting for all threads, a channel is drained once its sending
+   thread has published enough progress that anything it sends later
+   is delivered after our next sync, given the minimum latency of the
+   links feeding the channel.
+
+   If the TimeVortex is thread safe, the channels aren't used and the
+   links insert into the receiving thread's TimeVortex directly.
+ */
 class ThreadSyncDirectSkip : public ThreadSync
 {
 public:
     /** Create a new ThreadSync object */
-    ThreadSyncDirectSkip(int num_threads, int thread, Simulation_impl* sim);
+    ThreadSyncDirectSkip(int num_threads, int thread, SimTime_t min_part, bool use_channels, Simulation_impl* sim);
     ThreadSyncDirectSkip() {} // For serialization only
     ~ThreadSyncDirectSkip();
 
     void setMaxPeriod(TimeConverter* period);
 
-    void before() override {}
+    void before() override;
     void after() override;
     void execute() override;
 
     /** Cause an exchange of Untimed Data to occur */
     void processLinkUntimedData() override {}
     /** Finish link configuration */
-    void finalizeLinkConfigurations() override {}
+    void finalizeLinkConfigurations() override;
     void prepareForComplete() override {}
 
     /** Set signals to exchange during sync */
@@ -64,6 +81,7 @@ public:
     {
         return nullptr;
     }
+    void registerDirectLink(Link* link, int remote_thread) override;
 
     uint64_t getDataSize() const;
 
@@ -76,9 +94,29 @@ private:
     static Core::ThreadSafe::Barrier barrier[3];
     double                           totalWaitTime;
     bool                             single_rank;
+    // True if SyncManager reads state shared by all threads after
+    // the sync, so all threads need to be through it first
+    bool                             need_barrier;
+    bool                             use_channels;
     static int                       sig_end_;
     static int                       sig_usr_;
     static int                       sig_alrm_;
+
+    // Direct links owned by this thread and the thread of their pair
+    std::vector<std::pair<Link*, int>> direct_links;
+    // Incoming channels, indexed by sending thread
+    std::vector<ThreadChannelQueue*>   channels;
+    // Minimum latency of the links feeding each incoming channel
+    std::vector<SimTime_t>             channel_lookahead;
+
+    // Sim cycle of the last sync this thread reached.  Everything it
+    // sent before then is in the channels of the receiving threads.
+    CACHE_ALIGNED(std::atomic<SimTime_t>, progress);
+
+    void waitForProgress(int sender, SimTime_t needed);
+
+    static std::vector<ThreadSyncDirectSkip*> instances;
+    static Core::ThreadSafe::Spinlock         instances_lock;
 };
 
 
@@ -104,16 +104,10 @@ ThreadSyncSimpleSkip::registerRemoteLink(int tid, const std::string& name, Link*
 void
 ThreadSyncSimpleSkip::before()
 {
-    SimTime_t current_cycle = sim->getCurrentSimCycle();
     // Empty all the queues and send events on the links
     for ( size_t i = 0; i < queues.size(); i++ ) {
-        ThreadSyncQueue*        queue = queues[i];
-        std::vector<Activity*>& vec   = queue->getVector();
-        for ( size_t j = 0; j < vec.size(); j++ ) {
-            Event*    ev    = static_cast<Event*>(vec[j]);
-            SimTime_t delay = ev->getDeliveryTime() - current_cycle;
-            getDeliveryLink(ev)->send(delay, ev);
-        }
+        ThreadSyncQueue* queue = queues[i];
+        sendEvents_sync(queue->getVector());
         queue->clear();
     }
 }
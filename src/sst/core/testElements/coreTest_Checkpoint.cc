@@ -68,6 +68,7 @@ coreTestCheckpoint::coreTestCheckpoint(ComponentId_t id, Params& params) :
 
     self_link = configureSelfLink(
         "clock_restart", clock_tc, new Event::Handler2<coreTestCheckpoint, &coreTestCheckpoint::restartClock>(this));
+    if ( params.find<bool>("local_event_scheduler", false) ) enableLocalEventScheduler();
 
     // Output
     output = new Output(params.find<std::string>("output_prefix", ""), params.find<uint32_t>("output_verbose", 0), 0,
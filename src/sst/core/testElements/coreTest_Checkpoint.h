@@ -81,6 +81,7 @@ public:
         { "test_string", "A test string", ""},
         { "clock_frequency", "Frequency for clock", "100kHz"},
         { "clock_duty_cycle", "Number of cycles to keep clock on and off", "10"},
+        { "local_event_scheduler", "Send self link events through a local event scheduler", "false"},
         // Testing output options
         { "output_prefix", "Prefix for output", ""},
         { "output_verbose", "Verbosity for output", "0"},
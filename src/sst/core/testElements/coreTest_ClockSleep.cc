@@ -0,0 +1,119 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/testElements/coreTest_ClockSleep.h"
+
+#include "sst/core/event.h"
+
+using namespace SST;
+using namespace SST::CoreTestComponent;
+
+coreTestClockSleep::coreTestClockSleep(ComponentId_t id, Params& params) :
+    Component(id),
+    timed_count(0),
+    event_count(0),
+    recv_count(0),
+    timed_calls(0),
+    event_calls(0)
+{
+    // tell the simulator not to end without us
+    registerAsPrimaryComponent();
+    primaryComponentDoNotEndSim();
+
+    my_id        = params.find<int>("id", 0);
+    sleep_cycles = params.find<Cycle_t>("sleep_cycles", 10);
+    num_ticks    = params.find<int>("num_ticks", 5);
+
+    std::string clock = params.find<std::string>("clock", "1GHz");
+
+    link = configureLink("port", new Event::Handler2<coreTestClockSleep, &coreTestClockSleep::handleEvent>(this));
+
+    timed_handler = new Clock::Handler2<coreTestClockSleep, &coreTestClockSleep::timedTick>(this);
+    event_handler = new Clock::Handler2<coreTestClockSleep, &coreTestClockSleep::eventTick>(this);
+    tc            = *registerClock(clock, timed_handler);
+    registerClock(clock, event_handler);
+}
+
+void
+coreTestClockSleep::handleEvent(Event* ev)
+{
+    getSimulationOutput().output("%d: received event at %" PRIu64 " ns\n", my_id, getCurrentSimTimeNano());
+    delete ev;
+    recv_count++;
+}
+
+bool
+coreTestClockSleep::timedTick(Cycle_t cycle)
+{
+    timed_calls++;
+    getSimulationOutput().output("%d: timed tick %d at cycle %" PRIu64 "\n", my_id, timed_count, cycle);
+    link->send(nullptr);
+
+    timed_count++;
+    if ( timed_count == num_ticks ) {
+        checkDone();
+        return true;
+    }
+    sleepClock(tc, timed_handler, cycle + sleep_cycles);
+    return false;
+}
+
+bool
+coreTestClockSleep::eventTick(Cycle_t cycle)
+{
+    event_calls++;
+    getSimulationOutput().output(
+        "%d: event tick at cycle %" PRIu64 " with %d events received\n", my_id, cycle, recv_count);
+
+    event_count++;
+    if ( recv_count == num_ticks ) {
+        checkDone();
+        return true;
+    }
+    sleepClockUntilEvent(tc, event_handler, link);
+    return false;
+}
+
+void
+coreTestClockSleep::checkDone()
+{
+    if ( timed_count == num_ticks && recv_count == num_ticks ) {
+        primaryComponentOKToEndSim();
+    }
+}
+
+void
+coreTestClockSleep::finish()
+{
+    getSimulationOutput().output("%d: timed handler called %" PRIu64 " times, event handler called %" PRIu64
+                                 " times\n",
+        my_id, timed_calls, event_calls);
+}
+
+void
+coreTestClockSleep::serialize_order(SST::Core::Serialization::serializer& ser)
+{
+    SST::Component::serialize_order(ser);
+    SST_SER(my_id);
+    SST_SER(sleep_cycles);
+    SST_SER(num_ticks);
+    SST_SER(timed_count);
+    SST_SER(event_count);
+    SST_SER(recv_count);
+    SST_SER(timed_calls);
+    SST_SER(event_calls);
+    SST_SER(tc);
+    SST_SER(link);
+    SST_SER(timed_handler);
+    SST_SER(event_handler);
+}
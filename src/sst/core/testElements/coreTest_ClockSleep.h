@@ -0,0 +1,93 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_CORETEST_CLOCKSLEEP_H
+#define SST_CORE_CORETEST_CLOCKSLEEP_H
+
+#include "sst/core/component.h"
+#include "sst/core/link.h"
+
+namespace SST::CoreTestComponent {
+
+/**
+   Tests putting clock handlers to sleep.  The timed handler sleeps
+   for a fixed number of cycles between ticks and sends an event to
+   the peer each time it wakes up.  The event handler sleeps until an
+   event arrives on the link.
+ */
+class coreTestClockSleep : public SST::Component
+{
+public:
+    // REGISTER THIS COMPONENT INTO THE ELEMENT LIBRARY
+    SST_ELI_REGISTER_COMPONENT(
+        coreTestClockSleep,
+        "coreTestElement",
+        "coreTestClockSleep",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "CoreTest Test Clock Handler Sleep",
+        COMPONENT_CATEGORY_UNCATEGORIZED
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "id",           "ID of component", "0" },
+        { "clock",        "Clock frequency", "1GHz" },
+        { "sleep_cycles", "Number of cycles the timed handler sleeps between ticks", "10" },
+        { "num_ticks",    "Number of times the timed handler ticks", "5" }
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_STATISTICS()
+
+    SST_ELI_DOCUMENT_PORTS(
+        {"port", "Link to peer component",  { "NullEvent", "" } }
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
+    )
+
+    coreTestClockSleep(SST::ComponentId_t id, SST::Params& params);
+    ~coreTestClockSleep() = default;
+
+    void setup() override {}
+    void finish() override;
+
+    coreTestClockSleep() :
+        Component()
+    {} // For serialization ONLY
+    void serialize_order(SST::Core::Serialization::serializer& ser) override;
+    ImplementSerializable(SST::CoreTestComponent::coreTestClockSleep)
+
+private:
+    void handleEvent(SST::Event* ev);
+    bool timedTick(SST::Cycle_t cycle);
+    bool eventTick(SST::Cycle_t cycle);
+
+    void checkDone();
+
+    int      my_id;
+    Cycle_t  sleep_cycles;
+    int      num_ticks;
+    int      timed_count;
+    int      event_count;
+    int      recv_count;
+    uint64_t timed_calls;
+    uint64_t event_calls;
+
+    SST::TimeConverter       tc;
+    SST::Link*               link;
+    SST::Clock::HandlerBase* timed_handler;
+    SST::Clock::HandlerBase* event_handler;
+};
+
+} // namespace SST::CoreTestComponent
+
+#endif // SST_CORE_CORETEST_CLOCKSLEEP_H
@@ -0,0 +1,90 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/testElements/coreTest_ClockedArray.h"
+
+using namespace SST;
+using namespace SST::CoreTestComponent;
+
+coreTestClockedArray::coreTestClockedArray(ComponentId_t id, Params& params) :
+    Component(id),
+    array_ticks(0),
+    handler_ticks(0),
+    last_cycle(0)
+{
+    // tell the simulator not to end without us
+    registerAsPrimaryComponent();
+    primaryComponentDoNotEndSim();
+
+    my_id       = params.find<int>("id", 0);
+    num_cycles  = params.find<Cycle_t>("num_cycles", 10);
+    leave_cycle = params.find<Cycle_t>("leave_cycle", 0);
+
+    std::string clock = params.find<std::string>("clock", "1GHz");
+
+    // Register the per-instance handler first so that it is called
+    // before the array tick
+    if ( leave_cycle != 0 ) {
+        registerClock(clock, new Clock::Handler2<coreTestClockedArray, &coreTestClockedArray::handlerTick>(this));
+    }
+    registerClockedArray<coreTestClockedArray, &coreTestClockedArray::tickAll>(clock);
+}
+
+void
+coreTestClockedArray::tickAll(Cycle_t cycle, coreTestClockedArray* const* instances, size_t count)
+{
+    for ( size_t i = 0; i < count; ++i ) {
+        coreTestClockedArray* comp = instances[i];
+        if ( comp->array_ticks == comp->num_cycles ) continue;
+        // Whether this is called before or after the handler on the
+        // leave cycle depends on the order the instances were
+        // constructed in, so don't count it
+        if ( comp->leave_cycle != 0 && cycle >= comp->leave_cycle ) continue;
+
+        comp->array_ticks++;
+        comp->last_cycle = cycle;
+        if ( comp->array_ticks == comp->num_cycles ) comp->primaryComponentOKToEndSim();
+    }
+}
+
+bool
+coreTestClockedArray::handlerTick(Cycle_t cycle)
+{
+    handler_ticks++;
+    if ( cycle == leave_cycle ) {
+        unregisterClockedArray<coreTestClockedArray, &coreTestClockedArray::tickAll>();
+        if ( array_ticks < num_cycles ) primaryComponentOKToEndSim();
+        return true;
+    }
+    return false;
+}
+
+void
+coreTestClockedArray::finish()
+{
+    getSimulationOutput().output("%d: array ticked %" PRIu64 " times (last at cycle %" PRIu64
+                                 "), handler ticked %" PRIu64 " times\n",
+        my_id, array_ticks, last_cycle, handler_ticks);
+}
+
+void
+coreTestClockedArray::serialize_order(SST::Core::Serialization::serializer& ser)
+{
+    SST::Component::serialize_order(ser);
+    SST_SER(my_id);
+    SST_SER(num_cycles);
+    SST_SER(leave_cycle);
+    SST_SER(array_ticks);
+    SST_SER(handler_ticks);
+    SST_SER(last_cycle);
+}
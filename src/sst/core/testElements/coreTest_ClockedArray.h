@@ -0,0 +1,80 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_CORETEST_CLOCKEDARRAY_H
+#define SST_CORE_CORETEST_CLOCKEDARRAY_H
+
+#include "sst/core/component.h"
+
+namespace SST::CoreTestComponent {
+
+/**
+   Tests ClockedArrays.  Every instance joins the same ClockedArray
+   and is ticked by a single static function.  Instances can
+   optionally also register their own clock handler, which leaves the
+   array on a given cycle.
+ */
+class coreTestClockedArray : public SST::Component
+{
+public:
+    // REGISTER THIS COMPONENT INTO THE ELEMENT LIBRARY
+    SST_ELI_REGISTER_COMPONENT(
+        coreTestClockedArray,
+        "coreTestElement",
+        "coreTestClockedArray",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "CoreTest Test Clocked Arrays",
+        COMPONENT_CATEGORY_UNCATEGORIZED
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "id",          "ID of component", "0" },
+        { "clock",       "Clock frequency", "1GHz" },
+        { "num_cycles",  "Number of cycles to count in the array tick", "10" },
+        { "leave_cycle", "If not 0, the per-instance handler leaves the array on this cycle", "0" }
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_STATISTICS()
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_PORTS()
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS()
+
+    coreTestClockedArray(SST::ComponentId_t id, SST::Params& params);
+    ~coreTestClockedArray() = default;
+
+    void setup() override {}
+    void finish() override;
+
+    coreTestClockedArray() :
+        Component()
+    {} // For serialization ONLY
+    void serialize_order(SST::Core::Serialization::serializer& ser) override;
+    ImplementSerializable(SST::CoreTestComponent::coreTestClockedArray)
+
+private:
+    static void tickAll(SST::Cycle_t cycle, coreTestClockedArray* const* instances, size_t count);
+    bool        handlerTick(SST::Cycle_t cycle);
+
+    int      my_id;
+    Cycle_t  num_cycles;
+    Cycle_t  leave_cycle;
+    uint64_t array_ticks;
+    uint64_t handler_ticks;
+    Cycle_t  last_cycle;
+};
+
+} // namespace SST::CoreTestComponent
+
+#endif // SST_CORE_CORETEST_CLOCKEDARRAY_H
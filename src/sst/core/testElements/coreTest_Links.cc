@@ -16,6 +16,7 @@
 #include "sst/core/event.h"
 
 #include <string>
+#include <vector>
 
 using namespace SST;
 using namespace SST::CoreTestComponent;
@@ -31,17 +32,25 @@ coreTestLinks::coreTestLinks(ComponentId_t id, Params& params) :
     registerAsPrimaryComponent();
     primaryComponentDoNotEndSim();
 
-    my_id = params.find<int>("id", 0);
+    my_id      = params.find<int>("id", 0);
+    batch_size = params.find<int>("batch_size", 1);
+    polling    = params.find<bool>("polling", false);
 
     UnitAlgebra link_tb  = params.find<UnitAlgebra>("link_time_base", "1ns");
     UnitAlgebra send_lat = params.find<UnitAlgebra>("added_send_latency", found_sendlat);
     UnitAlgebra recv_lat = params.find<UnitAlgebra>("added_recv_latency", found_recvlat);
 
     // configure out links
-    E = configureLink("Elink", link_tb.toString(),
-        new Event::Handler2<coreTestLinks, &coreTestLinks::handleEvent, std::string>(this, "East"));
-    W = configureLink("Wlink", link_tb.toString(),
-        new Event::Handler2<coreTestLinks, &coreTestLinks::handleEvent, std::string>(this, "West"));
+    if ( polling ) {
+        E = configureLink("Elink", link_tb.toString());
+        W = configureLink("Wlink", link_tb.toString());
+    }
+    else {
+        E = configureLink("Elink", link_tb.toString(),
+            new Event::Handler2<coreTestLinks, &coreTestLinks::handleEvent, std::string>(this, "East"));
+        W = configureLink("Wlink", link_tb.toString(),
+            new Event::Handler2<coreTestLinks, &coreTestLinks::handleEvent, std::string>(this, "West"));
+    }
 
     if ( found_sendlat ) {
         E->addSendLatency(1, send_lat.toString());
@@ -65,7 +74,7 @@ coreTestLinks::handleEvent(Event* ev, std::string from)
         "%d: received event at: %" PRIu64 " ns on link %s\n", my_id, getCurrentSimTimeNano(), from.c_str());
     delete ev;
     recv_count++;
-    if ( recv_count == 8 ) {
+    if ( recv_count == 8 * batch_size ) {
         primaryComponentOKToEndSim();
     }
 }
@@ -73,13 +82,40 @@ coreTestLinks::handleEvent(Event* ev, std::string from)
 bool
 coreTestLinks::clockTic(Cycle_t cycle)
 {
+    if ( polling ) {
+        // Poll the links every cycle until all the events have
+        // arrived.  The first 4 cycles send with decreasing additional
+        // latency so the events arrive in the reverse of the order
+        // they were sent.
+        while ( Event* ev = E->recv() ) {
+            handleEvent(ev, "East");
+        }
+        while ( Event* ev = W->recv() ) {
+            handleEvent(ev, "West");
+        }
+        if ( recv_count == 8 * batch_size ) return true;
+        if ( cycle < 5 ) {
+            E->send((5 - cycle) * 20, nullptr);
+            W->send((5 - cycle) * 20, nullptr);
+        }
+        return false;
+    }
+
     // Each clock cycle, send with increasing addtional latency, for 4 cycles, end of 5th
     if ( cycle == 5 ) {
         return true;
     }
 
-    E->send(cycle, nullptr);
-    W->send(cycle, nullptr);
+    if ( batch_size > 1 ) {
+        // Null entries are sent as NullEvents, same as send()
+        std::vector<Event*> events(batch_size, nullptr);
+        E->sendBatch(cycle, events);
+        W->sendBatch(cycle, events);
+    }
+    else {
+        E->send(cycle, nullptr);
+        W->send(cycle, nullptr);
+    }
 
     // return false so we keep going
     return false;
@@ -35,7 +35,9 @@ public:
         { "id",                 "ID of component", "" },
         { "added_send_latency", "Additional output latency to add to sends", "0ns"},
         { "added_recv_latency", "Additional input latency to add to incoming events", "0ns"},
-        { "link_time_base",     "Timebase for links", "1ns" }
+        { "link_time_base",     "Timebase for links", "1ns" },
+        { "batch_size",         "Number of events to send on each link per cycle using sendBatch()", "1" },
+        { "polling",            "Poll the links each cycle instead of using handlers.  Events are sent so that they arrive in reverse order.", "false" }
     )
 
     // Optional since there is nothing to document
@@ -59,6 +61,8 @@ public:
 private:
     int my_id;
     int recv_count;
+    int batch_size;
+    bool polling;
 
     void         handleEvent(SST::Event* ev, std::string from);
     virtual bool clockTic(SST::Cycle_t);
@@ -24,7 +24,7 @@ public:
 public:
     void serialize_order(SST::Core::Serialization::serializer& ser) override { Event::serialize_order(ser); }
 
-    ImplementSerializable(SST::CoreTestMessageGeneratorComponent::coreTestMessage);
+    ImplementTriviallyRelocatableEvent(SST::CoreTestMessageGeneratorComponent::coreTestMessage);
 };
 
 } // namespace SST::CoreTestMessageGeneratorComponent
@@ -16,15 +16,20 @@
 #include "sst/core/testElements/coreTest_Serialization.h"
 
 #include "sst/core/componentInfo.h"
+#include "sst/core/interfaces/stdMem.h"
+#include "sst/core/interfaces/stringEvent.h"
 #include "sst/core/link.h"
 #include "sst/core/objectSerialization.h"
 #include "sst/core/rng/mersenne.h"
 #include "sst/core/rng/rng.h"
 #include "sst/core/serialization/impl/serialize_utility.h"
+#include "sst/core/sync/syncQueue.h"
 #include "sst/core/warnmacros.h"
 
+#include <algorithm>
 #include <array>
 #include <bitset>
+#include <cinttypes>
 #include <deque>
 #include <forward_list>
 #include <iostream>
@@ -36,6 +41,7 @@
 #include <set>
 #include <string>
 #include <tuple>
+#include <typeinfo>
 #include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
@@ -665,6 +671,52 @@ struct RecursiveSerializationTest : public SST::Core::Serialization::serializabl
     ImplementSerializable(RecursiveSerializationTest)
 };
 
+class RelocatableTestEvent : public SST::Event
+{
+public:
+    RelocatableTestEvent() = default;
+    explicit RelocatableTestEvent(uint64_t in) :
+        value(in)
+    {
+        for ( int i = 0; i < 4; ++i )
+            data[i] = static_cast<int32_t>(in) * (i + 1);
+    }
+
+    uint64_t value   = 0;
+    int32_t  data[4] = {};
+
+    void serialize_order(SST::Core::Serialization::serializer& ser) override
+    {
+        Event::serialize_order(ser);
+        SST_SER(value);
+        SST_SER(data);
+    }
+
+    ImplementTriviallyRelocatableEvent(RelocatableTestEvent)
+};
+
+// Doesn't use ImplementTriviallyRelocatableEvent(), so it has to go
+// through serialize_order() even though its parent doesn't
+class DerivedRelocatableTestEvent : public RelocatableTestEvent
+{
+public:
+    DerivedRelocatableTestEvent() = default;
+    explicit DerivedRelocatableTestEvent(uint64_t in) :
+        RelocatableTestEvent(in),
+        extra(in + 1)
+    {}
+
+    uint64_t extra = 0;
+
+    void serialize_order(SST::Core::Serialization::serializer& ser) override
+    {
+        RelocatableTestEvent::serialize_order(ser);
+        SST_SER(extra);
+    }
+
+    ImplementSerializable(DerivedRelocatableTestEvent)
+};
+
 coreTestSerialization::coreTestSerialization(ComponentId_t id, Params& params) :
     Component(id)
 {
@@ -1410,6 +1462,144 @@ coreTestSerialization::coreTestSerialization(ComponentId_t id, Params& params) :
                        "serialize/deserialize properly\n");
         }
     }
+    else if ( test == "stdmem_payload" ) {
+        using StandardMem = SST::Interfaces::StandardMem;
+
+        std::vector<uint8_t> line(64);
+        for ( size_t i = 0; i < line.size(); ++i )
+            line[i] = static_cast<uint8_t>(i * 3);
+        StandardMem::Payload payload(line);
+
+        // Response and forwarded write share the same data
+        StandardMem::Read*     read  = new StandardMem::Read(0x1000, line.size());
+        StandardMem::ReadResp* resp  = new StandardMem::ReadResp(read, payload);
+        StandardMem::Write*    write = new StandardMem::Write(0x2000, line.size(), resp->getPayload());
+        if ( !resp->payload.sharesDataWith(payload) || !write->payload.sharesDataWith(payload) ||
+             payload.useCount() != 3 ) {
+            out.output("ERROR: StandardMem::Payload was not shared between requests (use count %" PRIu32 ")\n",
+                payload.useCount());
+        }
+        if ( resp->getDataSize() != line.size() || !std::equal(line.begin(), line.end(), resp->getDataPtr()) ) {
+            out.output("ERROR: StandardMem::ReadResp did not return the Payload data\n");
+        }
+
+        // The std::vector constructors still work and can be turned
+        // into a Payload
+        StandardMem::WriteUnlock* unlock = new StandardMem::WriteUnlock(0x3000, line.size(), line);
+        if ( !unlock->payload.empty() || unlock->getPayload().toVector() != line ) {
+            out.output("ERROR: StandardMem::WriteUnlock created from a std::vector did not return its data\n");
+        }
+
+        // Round trip the requests through the serializer
+        StandardMem::Request* reqs[] = { resp, write, unlock };
+        for ( auto* req : reqs ) {
+            StandardMem::Request* in     = req;
+            StandardMem::Request* result = nullptr;
+            serializeDeserialize(in, result);
+
+            const uint8_t* data = nullptr;
+            size_t         size = 0;
+            if ( auto* r = dynamic_cast<StandardMem::ReadResp*>(result) ) {
+                data = r->getDataPtr();
+                size = r->getDataSize();
+            }
+            else if ( auto* w = dynamic_cast<StandardMem::Write*>(result) ) {
+                data = w->getDataPtr();
+                size = w->getDataSize();
+            }
+            else if ( auto* u = dynamic_cast<StandardMem::WriteUnlock*>(result) ) {
+                data = u->getDataPtr();
+                size = u->getDataSize();
+            }
+            if ( size != line.size() || !std::equal(line.begin(), line.end(), data) ) {
+                out.output("ERROR: StandardMem request with data did not serialize/deserialize properly: %s\n",
+                    req->getString().c_str());
+            }
+            delete result;
+        }
+
+        delete read;
+        delete resp;
+        delete write;
+        delete unlock;
+        if ( payload.useCount() != 1 ) {
+            out.output("ERROR: StandardMem::Payload use count is %" PRIu32 " after requests were deleted\n",
+                payload.useCount());
+        }
+
+        // Buffers too big for the memory pools
+        StandardMem::Payload big(StandardMem::Payload::max_pooled_size * 2, 0xa5);
+        StandardMem::Payload big_result;
+        serializeDeserialize(big, big_result);
+        if ( big_result.size() != big.size() || !std::equal(big.begin(), big.end(), big_result.begin()) ) {
+            out.output("ERROR: Large StandardMem::Payload did not serialize/deserialize properly\n");
+        }
+    }
+    else if ( test == "relocatable_event" ) {
+        // Events as they are sent between ranks by the RankSyncs
+        std::vector<Activity*> events;
+        events.push_back(new RelocatableTestEvent(rng->generateNextUInt64()));
+        events.push_back(new DerivedRelocatableTestEvent(rng->generateNextUInt64()));
+        events.push_back(new SST::Interfaces::StringEvent("test_string"));
+        events.push_back(new SST::EmptyEvent());
+        events.push_back(new RelocatableTestEvent(rng->generateNextUInt64()));
+        for ( auto* event : events ) {
+            event->setDeliveryTime(rng->generateNextUInt32());
+            event->setOrderTag(rng->generateNextUInt32());
+        }
+
+#ifndef __SST_DEBUG_EVENT_TRACKING__
+        if ( static_cast<Event*>(events[0])->getTriviallyRelocatableSize() != sizeof(RelocatableTestEvent) ||
+             static_cast<Event*>(events[1])->getTriviallyRelocatableSize() != 0 ||
+             static_cast<Event*>(events[2])->getTriviallyRelocatableSize() != 0 ||
+             static_cast<Event*>(events[3])->getTriviallyRelocatableSize() != sizeof(SST::EmptyEvent) ) {
+            out.output("ERROR: Event::getTriviallyRelocatableSize() returned the wrong size\n");
+        }
+#endif
+
+        SST::Core::Serialization::serializer ser;
+        ser.start_sizing();
+        RankSyncQueue::serializeEvents(ser, events);
+        size_t size   = ser.size();
+        char*  buffer = new char[size];
+        ser.start_packing(buffer, size);
+        RankSyncQueue::serializeEvents(ser, events);
+
+        std::vector<Activity*> result;
+        ser.start_unpacking(buffer, size);
+        RankSyncQueue::serializeEvents(ser, result);
+        delete[] buffer;
+
+        if ( result.size() != events.size() ) {
+            out.output("ERROR: Expected %zu events after deserialization, got %zu\n", events.size(), result.size());
+        }
+        for ( size_t i = 0; i < std::min(events.size(), result.size()); ++i ) {
+            Activity* in  = events[i];
+            Activity* res = result[i];
+            bool      ok  = typeid(*in) == typeid(*res) && in->getDeliveryTime() == res->getDeliveryTime() &&
+                      in->getPriority() == res->getPriority() && in->getOrderTag() == res->getOrderTag();
+            if ( ok ) {
+                if ( auto* d = dynamic_cast<DerivedRelocatableTestEvent*>(in) ) {
+                    ok = d->extra == static_cast<DerivedRelocatableTestEvent*>(res)->extra;
+                }
+                if ( auto* r = dynamic_cast<RelocatableTestEvent*>(in) ) {
+                    auto* rr = static_cast<RelocatableTestEvent*>(res);
+                    ok       = ok && r->value == rr->value && std::equal(r->data, r->data + 4, rr->data);
+                }
+                if ( auto* str = dynamic_cast<SST::Interfaces::StringEvent*>(in) ) {
+                    ok = str->getString() == static_cast<SST::Interfaces::StringEvent*>(res)->getString();
+                }
+            }
+            if ( !ok ) {
+                out.output("ERROR: Event %zu (%s) did not serialize/deserialize properly\n", i, in->cls_name());
+            }
+        }
+
+        for ( auto* event : events )
+            delete event;
+        for ( auto* event : result )
+            delete event;
+    }
     else {
         out.fatal(CALL_INFO_LONG, 1, "ERROR: Unknown serialization test specified: %s\n", test.c_str());
     }
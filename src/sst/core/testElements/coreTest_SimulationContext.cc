@@ -0,0 +1,80 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/testElements/coreTest_SimulationContext.h"
+
+#include "sst/core/simulation_impl.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <unordered_map>
+
+using namespace SST;
+using namespace SST::CoreTestSimulationContext;
+
+coreTestSimulationContext::coreTestSimulationContext(ComponentId_t id, Params& params) :
+    Component(id)
+{
+    // tell the simulator not to end without us
+    registerAsPrimaryComponent();
+    primaryComponentDoNotEndSim();
+
+    my_id      = params.find<int>("id", 0);
+    iterations = params.find<uint64_t>("iterations", 1000000);
+}
+
+void
+coreTestSimulationContext::setup()
+{
+    Simulation_impl* sim = Simulation_impl::getSimulation();
+
+    // Make sure we got the simulation object for our own thread
+    bool ok = (sim->getRank() == getRank()) && (nullptr != sim->getTimeVortex());
+
+    // Rebuild the thread id keyed map that getSimulation() used to
+    // look in so the two can be timed against each other
+    std::unordered_map<std::thread::id, Simulation_impl*> instance_map;
+    instance_map[std::this_thread::get_id()] = sim;
+
+    // The signal fence keeps the compiler from hoisting the lookup
+    // out of the loop
+    uintptr_t check = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for ( uint64_t i = 0; i < iterations; ++i ) {
+        check ^= reinterpret_cast<uintptr_t>(instance_map.at(std::this_thread::get_id()));
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+    }
+    auto   middle = std::chrono::steady_clock::now();
+    double map_ns = std::chrono::duration<double, std::nano>(middle - start).count();
+
+    for ( uint64_t i = 0; i < iterations; ++i ) {
+        check ^= reinterpret_cast<uintptr_t>(Simulation_impl::getSimulation());
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+    }
+    auto   end    = std::chrono::steady_clock::now();
+    double tls_ns = std::chrono::duration<double, std::nano>(end - middle).count();
+
+    // Both loops xor in the same pointer the same number of times
+    if ( check != 0 ) ok = false;
+
+    Output& out = getSimulationOutput();
+    out.output("%d: getSimulation() %s\n", my_id, ok ? "returned this thread's simulation" : "FAILED");
+    if ( iterations > 0 ) {
+        out.output("# %d: map lookup %.2f ns/call, thread-local lookup %.2f ns/call\n", my_id, map_ns / iterations,
+            tls_ns / iterations);
+    }
+
+    primaryComponentOKToEndSim();
+}
@@ -0,0 +1,68 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_CORETEST_SIMULATIONCONTEXT_H
+#define SST_CORE_CORETEST_SIMULATIONCONTEXT_H
+
+#include "sst/core/component.h"
+
+#include <cstdint>
+
+namespace SST::CoreTestSimulationContext {
+
+/**
+   Checks that Simulation_impl::getSimulation() returns the simulation
+   object for the calling thread and measures the per-call cost of the
+   thread-local lookup against the thread id keyed map lookup it
+   replaced.  Timing lines start with '#' so they can be filtered out
+   of the reference compare.
+ */
+class coreTestSimulationContext : public SST::Component
+{
+public:
+    // REGISTER THIS COMPONENT INTO THE ELEMENT LIBRARY
+    SST_ELI_REGISTER_COMPONENT(
+        coreTestSimulationContext,
+        "coreTestElement",
+        "coreTestSimulationContext",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "CoreTest Test Simulation Context Lookup",
+        COMPONENT_CATEGORY_UNCATEGORIZED
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "id",         "ID of component", "0" },
+        { "iterations", "Number of lookups to time for each method", "1000000" }
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_STATISTICS()
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_PORTS()
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS()
+
+    coreTestSimulationContext(SST::ComponentId_t id, SST::Params& params);
+    ~coreTestSimulationContext() = default;
+
+    void setup() override;
+    void finish() override {}
+
+private:
+    int      my_id;
+    uint64_t iterations;
+};
+
+} // namespace SST::CoreTestSimulationContext
+
+#endif // SST_CORE_CORETEST_SIMULATIONCONTEXT_H
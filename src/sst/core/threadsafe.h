@@ -338,6 +338,143 @@ public:
     }
 };
 
+/**
+   Lock-free single-producer/single-consumer queue.  Items are stored
+   in fixed size blocks that are linked together as needed, so
+   insert() never fails or waits on the consumer.  The consumer hands
+   each drained block back to the producer for reuse, so a queue that
+   stays below BlockSize items does no allocation once warmed up.
+   The producer and consumer state are kept on separate cache lines.
+ */
+template <typename T, size_t BlockSize = 256>
+class SPSCQueue
+{
+    struct Block
+    {
+        std::atomic<size_t> count; // number of items published
+        std::atomic<Block*> next;
+        T                   items[BlockSize];
+
+        Block() :
+            count(0),
+            next(nullptr)
+        {}
+    };
+
+    // Producer side
+    CACHE_ALIGNED(Block*, tail);
+    // Consumer side
+    CACHE_ALIGNED(Block*, head);
+    size_t head_index;
+    // Drained block waiting to be reused by the producer
+    CACHE_ALIGNED(std::atomic<Block*>, spare);
+
+    Block* getBlock()
+    {
+        Block* block = spare.exchange(nullptr, std::memory_order_acquire);
+        if ( block == nullptr ) return new Block();
+        block->count.store(0, std::memory_order_relaxed);
+        block->next.store(nullptr, std::memory_order_relaxed);
+        return block;
+    }
+
+public:
+    SPSCQueue() :
+        head_index(0),
+        spare(nullptr)
+    {
+        head = tail = new Block();
+    }
+
+    ~SPSCQueue()
+    {
+        while ( head != nullptr ) {
+            Block* tmp = head;
+            head       = tmp->next.load();
+            delete tmp;
+        }
+        delete spare.load();
+    }
+
+    SPSCQueue(const SPSCQueue&)            = delete;
+    SPSCQueue& operator=(const SPSCQueue&) = delete;
+
+    /** Insert an item.  Producer thread only. */
+    void insert(const T& t) { insert(&t, 1); }
+
+    /** Insert n items, publishing them once per block.  Producer
+     * thread only. */
+    void insert(const T* items, size_t n)
+    {
+        while ( n > 0 ) {
+            Block* block = tail;
+            size_t index = block->count.load(std::memory_order_relaxed);
+            if ( index == BlockSize ) {
+                block = getBlock();
+                index = 0;
+            }
+            size_t count = BlockSize - index;
+            if ( count > n ) count = n;
+            for ( size_t i = 0; i < count; ++i ) {
+                block->items[index + i] = items[i];
+            }
+            block->count.store(index + count, std::memory_order_release);
+            // New blocks are only linked in once they hold an item
+            if ( block != tail ) {
+                tail->next.store(block, std::memory_order_release);
+                tail = block;
+            }
+            items += count;
+            n -= count;
+        }
+    }
+
+    /** Returns true if there are no published items.  Consumer thread
+     * only. */
+    bool empty() const
+    {
+        if ( head_index != head->count.load(std::memory_order_acquire) ) return false;
+        return head_index < BlockSize || head->next.load(std::memory_order_acquire) == nullptr;
+    }
+
+    /** Remove the oldest item.  Consumer thread only. */
+    bool try_remove(T& result)
+    {
+        if ( head_index == head->count.load(std::memory_order_acquire) ) {
+            if ( head_index < BlockSize ) return false;
+            Block* next = head->next.load(std::memory_order_acquire);
+            if ( next == nullptr ) return false;
+            Block* old = spare.exchange(head, std::memory_order_release);
+            delete old;
+            head       = next;
+            head_index = 0;
+        }
+        result = head->items[head_index++];
+        return true;
+    }
+
+    /** Append all the published items to out.  Consumer thread
+     * only.  Returns the number of items removed. */
+    size_t remove_all(std::vector<T>& out)
+    {
+        size_t removed = 0;
+        while ( true ) {
+            size_t count = head->count.load(std::memory_order_acquire);
+            out.insert(out.end(), head->items + head_index, head->items + count);
+            removed += count - head_index;
+            head_index = count;
+            if ( count < BlockSize ) break;
+            Block* next = head->next.load(std::memory_order_acquire);
+            if ( next == nullptr ) break;
+            Block* old = spare.exchange(head, std::memory_order_release);
+            delete old;
+            head       = next;
+            head_index = 0;
+        }
+        return removed;
+    }
+};
+
 // Replace with std::atomic_fetch_max at C++26
 template <typename T>
 void
@@ -16,6 +16,7 @@
 #include "sst/core/event.h"
 #include "sst/core/simulation_impl.h"
 
+#include <algorithm>
 #include <string>
 
 namespace SST {
@@ -66,6 +67,36 @@ TimeVortex::print(Output& out) const
     }
 }
 
+#ifdef __SST_COMPACT_ACTIVITY_KEY__
+uint64_t
+TimeVortex::renumberQueueOrder()
+{
+    // The stored queue orders haven't wrapped since the last
+    // renumbering, so sorting on the full key gives the current order
+    std::vector<Activity*> contents;
+    getContents(contents);
+
+    std::sort(contents.begin(), contents.end(), Activity::less<true, true, true>());
+
+    for ( size_t i = 0; i < contents.size(); ++i ) {
+        contents[i]->setQueueOrder(i);
+    }
+    return contents.size();
+}
+#endif
+
+void
+TimeVortex::popBatch(std::vector<Activity*>& batch)
+{
+    Activity* first = pop();
+    batch.push_back(first);
+    if ( !first->isEvent() ) return;
+
+    while ( !empty() && sameBatch(first, front()) ) {
+        batch.push_back(pop());
+    }
+}
+
 
 SST_ELI_DEFINE_CTOR_EXTERN(TimeVortex)
 SST_ELI_DEFINE_INFO_EXTERN(TimeVortex)
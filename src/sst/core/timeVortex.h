@@ -61,7 +61,62 @@ public:
      */
     virtual void getContents(std::vector<Activity*>& activities) const = 0;
 
+    /**
+       Pop the next batch of activities to be executed.  The batch
+       starts with the activity that would be returned by pop().  If
+       that activity is an Event, all other Events with the same
+       delivery time and priority are also popped, in the order they
+       would have been returned by pop().  Actions are always returned
+       in a batch by themselves since they can change the state of
+       the run loop (checkpointing, stopping, syncing, etc).
+
+       The default implementation uses front() and pop().  Derived
+       classes can override for a more efficient implementation.
+
+       @param batch Vector the activities will be appended to
+     */
+    virtual void popBatch(std::vector<Activity*>& batch);
+
 protected:
+    /**
+       Checks to see if next can be executed in the same batch as
+       first (see popBatch())
+     */
+    static inline bool sameBatch(const Activity* first, const Activity* next)
+    {
+        return next->isEvent() && next->getDeliveryTime() == first->getDeliveryTime() &&
+               next->getPriority() == first->getPriority();
+    }
+
+    /**
+       Sets the queue order of an activity being inserted and advances
+       insert_order.  Derived classes should use this instead of
+       calling Activity::setQueueOrder() directly.  When the compact
+       activity key is enabled, the pending activities are renumbered
+       before the stored queue order would wrap.
+     */
+    inline void assignQueueOrder(Activity* activity, uint64_t& insert_order)
+    {
+#ifdef __SST_COMPACT_ACTIVITY_KEY__
+        if ( UNLIKELY(insert_order != 0 && (insert_order & Activity::queue_order_mask) == 0) ) {
+            insert_order = renumberQueueOrder();
+        }
+#endif
+        activity->setQueueOrder(insert_order++);
+    }
+
+#ifdef __SST_COMPACT_ACTIVITY_KEY__
+    /**
+       Renumbers the queue order of all pending activities starting at
+       0 and returns the next unused queue order.  The relative order
+       of the activities doesn't change, so any sorted structure or
+       heap built with Activity::less or Activity::greater stays
+       valid.  The default implementation uses getContents().  Called
+       with the same locks held as insert().
+     */
+    virtual uint64_t renumberQueueOrder();
+#endif
+
     uint64_t max_depth;
 };
 
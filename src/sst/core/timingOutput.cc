@@ -100,6 +100,12 @@ TimingOutput::renderText()
     ua_buffer = format_string("%" PRIu64 "B", u64map_.at(GLOBAL_MEMPOOL_SIZE));
     UnitAlgebra global_mempool_size_ua(ua_buffer);
 
+    ua_buffer = format_string("%" PRIu64 "B", u64map_.at(MAX_LINK_STORAGE_SIZE));
+    UnitAlgebra max_link_storage_size_ua(ua_buffer);
+
+    ua_buffer = format_string("%" PRIu64 "B", u64map_.at(GLOBAL_LINK_STORAGE_SIZE));
+    UnitAlgebra global_link_storage_size_ua(ua_buffer);
+
     output_.output("\n");
     output_.output("\n");
     output_.output("------------------------------------------------------------\n");
@@ -117,6 +123,9 @@ TimingOutput::renderText()
     output_.output("  Max Input Blocks:                %" PRIu64 " blocks\n", u64map_.at(GLOBAL_MAX_IO_IN));
     output_.output("  Max mempool usage:               %s\n", max_mempool_size_ua.toStringBestSI().c_str());
     output_.output("  Global mempool usage:            %s\n", global_mempool_size_ua.toStringBestSI().c_str());
+    output_.output("  Max link storage:                %s\n", max_link_storage_size_ua.toStringBestSI().c_str());
+    output_.output("  Global link storage:             %s\n", global_link_storage_size_ua.toStringBestSI().c_str());
+    output_.output("  Global links:                    %" PRIu64 " links\n", u64map_.at(GLOBAL_LINKS));
     output_.output("  Global active activities:        %" PRIu64 " activities\n", u64map_.at(GLOBAL_ACTIVE_ACTIVITIES));
     output_.output("  Current global TimeVortex depth: %" PRIu64 " entries\n", u64map_.at(GLOBAL_CURRENT_TV_DEPTH));
     output_.output("  Max TimeVortex depth:            %" PRIu64 " entries\n", u64map_.at(GLOBAL_MAX_TV_DEPTH));
@@ -42,6 +42,9 @@ public:
         GLOBAL_SYNC_DATA_SIZE,     // Global Sync data size
         MAX_MEMPOOL_SIZE,          // Max mempool usage (bytes)
         GLOBAL_MEMPOOL_SIZE,       // Global mempool usage (bytes)
+        MAX_LINK_STORAGE_SIZE,     // Max link storage (bytes)
+        GLOBAL_LINK_STORAGE_SIZE,  // Global link storage (bytes)
+        GLOBAL_LINKS,              // Global number of links (sum of peak per rank)
         MAX_BUILD_TIME,            // Build time (wallclock seconds)
         MAX_RUN_TIME,              // Run loop time (wallclock seconds)
         MAX_TOTAL_TIME,            // Total time (wallclock seconds)
@@ -64,6 +67,9 @@ public:
         { GLOBAL_SYNC_DATA_SIZE, "global_sync_data_size" },
         { MAX_MEMPOOL_SIZE, "max_mempool_size" },
         { GLOBAL_MEMPOOL_SIZE, "global_mempool_size" },
+        { MAX_LINK_STORAGE_SIZE, "max_link_storage_size" },
+        { GLOBAL_LINK_STORAGE_SIZE, "global_link_storage_size" },
+        { GLOBAL_LINKS, "global_links" },
         { MAX_BUILD_TIME, "max_build_time" },
         { MAX_RUN_TIME, "max_run_time" },
         { MAX_TOTAL_TIME, "max_total_time" },
@@ -1,4 +1,9 @@
 import sst
+import sys
+
+# Passing "local_scheduler" as a model option sends the self link
+# events through each component's local event scheduler
+local_scheduler = len(sys.argv) == 2 and sys.argv[1] == "local_scheduler"
 
 # Define the simulation components
 comp_count = 4   # Number of components
@@ -13,6 +18,7 @@ for x in range(0,comp_count):
       "test_string" : "hello",
       "output_prefix" : "c" + str(x) + " talking",
       "output_verbose" : 2,
+      "local_event_scheduler" : local_scheduler,
       })
 
     if x == start:
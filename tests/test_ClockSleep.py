@@ -0,0 +1,32 @@
+# Copyright 2009-2025 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2025, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+
+# Define the simulation components
+comp_c0 = sst.Component("c0", "coreTestElement.coreTestClockSleep")
+comp_c0.addParams({
+    "id" : 0,
+    "clock" : "1GHz",
+    "sleep_cycles" : 10,
+    "num_ticks" : 5
+})
+
+comp_c1 = sst.Component("c1", "coreTestElement.coreTestClockSleep")
+comp_c1.addParams({
+    "id" : 1,
+    "clock" : "500MHz",
+    "sleep_cycles" : 7,
+    "num_ticks" : 5
+})
+
+# Define the links
+link = sst.Link("link")
+link.connect( (comp_c0, "port", "3 ns"), (comp_c1, "port", "3 ns") )
@@ -0,0 +1,27 @@
+# Copyright 2009-2025 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2025, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+
+# Components c0-c3 share a 1GHz array and c4-c5 share a 500MHz
+# array.  c1 and c4 leave their arrays early.
+params = [
+    { "clock" : "1GHz",   "num_cycles" : 20 },
+    { "clock" : "1GHz",   "num_cycles" : 20, "leave_cycle" : 7 },
+    { "clock" : "1GHz",   "num_cycles" : 35 },
+    { "clock" : "1GHz",   "num_cycles" : 50 },
+    { "clock" : "500MHz", "num_cycles" : 15, "leave_cycle" : 4 },
+    { "clock" : "500MHz", "num_cycles" : 30 },
+]
+
+for i, p in enumerate(params):
+    comp = sst.Component("c{0}".format(i), "coreTestElement.coreTestClockedArray")
+    comp.addParam("id", i)
+    comp.addParams(p)
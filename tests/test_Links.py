@@ -14,10 +14,14 @@ import sys
 dangling = False
 wrong_port = False
 unused = False
+batch = False
+polling = False
 if len(sys.argv) == 2:
     if sys.argv[1] == "dangling": dangling=True
     if sys.argv[1] == "wrong_port": wrong_port=True
     if sys.argv[1] == "unused": unused=True
+    if sys.argv[1] == "batch": batch=True
+    if sys.argv[1] == "polling": polling=True
 
 # Define the simulation components
 comp_c0 = sst.Component("c1", "coreTestElement.coreTestLinks")
@@ -48,6 +52,14 @@ comp_c3.addParams({
     "link_time_base"     : "4 ns"
 })
 
+if batch:
+    for comp in [comp_c0, comp_c1, comp_c2, comp_c3]:
+        comp.addParam("batch_size", 2)
+
+if polling:
+    for comp in [comp_c0, comp_c1, comp_c2, comp_c3]:
+        comp.addParam("polling", True)
+
 # Define the links
 link_0 = sst.Link("link_0")
 if not dangling:
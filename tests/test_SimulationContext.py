@@ -0,0 +1,20 @@
+# Copyright 2009-2025 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2025, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+
+# One component per thread is enough, but use a few more so that
+# threads host more than one when run multithreaded
+for i in range(4):
+    comp = sst.Component("c{0}".format(i), "coreTestElement.coreTestSimulationContext")
+    comp.addParams({
+        "id" : i,
+        "iterations" : 1000000
+    })
@@ -99,6 +99,9 @@ class testcase_Checkpoint(SSTTestCase):
     def test_Checkpoint_SharedObject_bool_array_n2one(self) -> None:
         self.checkpoint_test_template("SharedObject", 1, 2, modelparams="--param=object_type:bool_array --param=num_entities:12 --param=full_initialization:true --param=checkpoint:true", outstr = "SharedObject_bool_array", n_to_one=True)
 
+    def test_Checkpoint_local_scheduler(self) -> None:
+        self.checkpoint_test_template("Checkpoint", 1, 1, modelparams="local_scheduler")
+
     def test_Checkpoint_n2one(self) -> None:
         self.checkpoint_test_template("Checkpoint", 1, 1, n_to_one=True)
 
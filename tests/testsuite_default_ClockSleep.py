@@ -0,0 +1,47 @@
+# -*- coding: utf-8 -*-
+#
+# Copyright 2009-2025 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2025, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+from sst_unittest import *
+from sst_unittest_support import *
+
+
+class testcase_ClockSleep(SSTTestCase):
+
+    def setUp(self):
+        super(type(self), self).setUp()
+        # Put test based setup code here. it is called once before every test
+
+    def tearDown(self):
+        # Put test based teardown code here. it is called once after every test
+        super(type(self), self).tearDown()
+
+#####
+
+    def test_ClockSleep(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_ClockSleep.py".format(testsuitedir)
+        reffile = "{0}/refFiles/test_ClockSleep.out".format(testsuitedir)
+        outfile = "{0}/test_ClockSleep.out".format(outdir)
+
+        self.run_sst(sdlfile, outfile)
+
+        # Output from the two components may be interleaved
+        # differently when run in parallel, so do a sorted compare
+        filter1 = StartsWithFilter("WARNING: No components are")
+        cmp_result = testing_compare_filtered_diff("ClockSleep", outfile, reffile, True, [filter1])
+        if not cmp_result:
+            diffdata = testing_get_diff_data("ClockSleep")
+            log_failure(diffdata)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile, reffile))
@@ -0,0 +1,76 @@
+# -*- coding: utf-8 -*-
+#
+# Copyright 2009-2025 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2025, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+from sst_unittest import *
+from sst_unittest_support import *
+
+
+class testcase_ClockedArray(SSTTestCase):
+
+    def setUp(self):
+        super(type(self), self).setUp()
+        # Put test based setup code here. it is called once before every test
+
+    def tearDown(self):
+        # Put test based teardown code here. it is called once after every test
+        super(type(self), self).tearDown()
+
+#####
+    parallelerr = "Test only supports serial execution"
+
+    def test_ClockedArray(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_ClockedArray.py".format(testsuitedir)
+        reffile = "{0}/refFiles/test_ClockedArray.out".format(testsuitedir)
+        outfile = "{0}/test_ClockedArray.out".format(outdir)
+
+        self.run_sst(sdlfile, outfile)
+
+        # Output order depends on the partitioning, so do a sorted
+        # compare
+        filter1 = StartsWithFilter("WARNING: Building component")
+        cmp_result = testing_compare_filtered_diff("ClockedArray", outfile, reffile, True, [filter1])
+        if not cmp_result:
+            diffdata = testing_get_diff_data("ClockedArray")
+            log_failure(diffdata)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile, reffile))
+
+    # Checkpoints part way through and restarts to make sure array
+    # membership is restored
+    @unittest.skipIf(testing_check_get_num_ranks() > 1, parallelerr)
+    @unittest.skipIf(testing_check_get_num_threads() > 1, parallelerr)
+    def test_ClockedArray_checkpoint(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_ClockedArray.py".format(testsuitedir)
+        reffile = "{0}/refFiles/test_ClockedArray.out".format(testsuitedir)
+        outfile_cpt = "{0}/test_ClockedArray_cpt.out".format(outdir)
+        outfile_rst = "{0}/test_ClockedArray_rst.out".format(outdir)
+        prefix = "ClockedArray_cpt"
+
+        options_cpt = ("--checkpoint-sim-period=10ns --checkpoint-prefix={0} "
+                       "--checkpoint-name-format='%p_%n' --output-directory=testsuite_clockedarray".format(prefix))
+        self.run_sst(sdlfile, outfile_cpt, other_args=options_cpt)
+
+        filters = [ StartsWithFilter("WARNING: Building component"), CheckpointInfoFilter() ]
+        cmp_result = testing_compare_filtered_diff("ClockedArray_cpt", outfile_cpt, reffile, True, filters)
+        self.assertTrue(cmp_result, "Output from checkpoint run {0} did not match reference file {1}".format(outfile_cpt, reffile))
+
+        sdlfile_rst = "{0}/testsuite_clockedarray/{1}/{1}_1/{1}_1.sstcpt".format(outdir, prefix)
+        self.run_sst(sdlfile_rst, outfile_rst, other_args="--load-checkpoint")
+
+        cmp_result = testing_compare_filtered_diff("ClockedArray_rst", outfile_rst, reffile, True, filters)
+        self.assertTrue(cmp_result, "Output from restart run {0} did not match reference file {1}".format(outfile_rst, reffile))
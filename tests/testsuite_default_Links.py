@@ -15,6 +15,9 @@ from sst_unittest import *
 from sst_unittest_support import *
 
 
+have_mpi = sst_core_config_include_file_get_value(define="SST_CONFIG_HAVE_MPI", type=int, default=0, disable_warning=True) == 1
+
+
 class testcase_Links(SSTTestCase):
 
     def setUp(self):
@@ -39,17 +42,68 @@ class testcase_Links(SSTTestCase):
     def test_Links_unused(self):
         self.component_test_template("unused", "--model-options=unused", 1)
 
+    def test_Links_batch(self):
+        self.component_test_template("batch", "--model-options=batch")
+
+    def test_Links_polling(self):
+        self.component_test_template("polling", "--model-options=polling")
+
+    # The rank syncs are only used when there is more than one rank,
+    # and multithreaded runs always use the parallel skip sync.  These
+    # always run with their own ranks and threads so they are covered
+    # even when the suite itself is run serially
+    rankerr = "Test sets its own ranks and threads"
+
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    @unittest.skipIf(testing_check_get_num_ranks() > 1, rankerr)
+    @unittest.skipIf(testing_check_get_num_threads() > 1, rankerr)
+    def test_Links_lookahead(self):
+        self.component_test_template("lookahead", "--rank-sync=lookahead", reftype="basic", ranks=2, threads=1)
+
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    @unittest.skipIf(testing_check_get_num_ranks() > 1, rankerr)
+    @unittest.skipIf(testing_check_get_num_threads() > 1, rankerr)
+    def test_Links_neighbor(self):
+        self.component_test_template("neighbor", "--rank-sync=neighbor", reftype="basic", ranks=2, threads=1)
+
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    @unittest.skipIf(testing_check_get_num_ranks() > 1, rankerr)
+    @unittest.skipIf(testing_check_get_num_threads() > 1, rankerr)
+    def test_Links_pipelined(self):
+        self.component_test_template("pipelined", "--rank-sync=pipelined", reftype="basic", ranks=2, threads=1)
+
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    @unittest.skipIf(testing_check_get_num_ranks() > 1, rankerr)
+    @unittest.skipIf(testing_check_get_num_threads() > 1, rankerr)
+    def test_Links_shmem(self):
+        self.component_test_template("shmem", "--rank-sync-shmem", reftype="basic", ranks=2, threads=1)
+
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    @unittest.skipIf(testing_check_get_num_ranks() > 1, rankerr)
+    @unittest.skipIf(testing_check_get_num_threads() > 1, rankerr)
+    def test_Links_parallel_skip(self):
+        self.component_test_template("parallel_skip", reftype="basic", ranks=2, threads=2)
+
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    @unittest.skipIf(testing_check_get_num_ranks() > 1, rankerr)
+    @unittest.skipIf(testing_check_get_num_threads() > 1, rankerr)
+    def test_Links_parallel_shmem(self):
+        self.component_test_template("parallel_shmem", "--rank-sync-shmem", reftype="basic", ranks=2, threads=2)
+
 #####
 
-    def component_test_template(self, testtype, extra_args="", rc=0):
+    # reftype: If set, is used in place of testtype to find the
+    # reference file, for tests that should match another test's output
+    # ranks/threads: If set, override the suite's ranks and threads
+    def component_test_template(self, testtype, extra_args="", rc=0, reftype=None, ranks=None, threads=None):
         testsuitedir = self.get_testsuite_dir()
         outdir = test_output_get_run_dir()
 
         sdlfile = "{0}/test_Links.py".format(testsuitedir)
-        reffile = "{0}/refFiles/test_Links_{1}.out".format(testsuitedir,testtype)
+        reffile = "{0}/refFiles/test_Links_{1}.out".format(testsuitedir,reftype if reftype else testtype)
         outfile = "{0}/test_Links_{1}.out".format(outdir,testtype)
 
-        if rc == 0: self.run_sst(sdlfile, outfile, other_args=extra_args, expected_rc=rc)
+        if rc == 0: self.run_sst(sdlfile, outfile, other_args=extra_args, expected_rc=rc, num_ranks=ranks, num_threads=threads)
         else:
             errfile = "{0}/test_Links_{1}.err".format(outdir,testtype)
             self.run_sst(sdlfile, outfile, errfile, other_args=extra_args, expected_rc=rc)
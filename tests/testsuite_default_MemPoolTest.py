@@ -34,26 +34,67 @@ class testcase_StatisticComponent(SSTTestCase):
     def test_MemPool_overflow(self):
         self.Statistics_test_template("overflow", 4) # force 4 threads
 
+    # Same as overflow, but with arenas backed by huge pages (or
+    # normal pages if none are available) and bound to NUMA nodes
+    @unittest.skipIf(testing_check_get_num_ranks() > 1, "Test only supports single rank runs")
+    def test_MemPool_overflow_hugepage(self):
+        self.Statistics_test_template("overflow", 4, "--hugepage-mempools", "overflow_hugepage") # force 4 threads
+
     def test_MemPool_undeleted_items(self):
         self.Statistics_test_template("undeleted_items")
 
+    # Writes the mempool statistics, checks them, then uses them to
+    # pre-size the pools for a second run
+    @unittest.skipIf(testing_check_get_num_ranks() > 1, "Test only supports single rank runs")
+    def test_MemPool_stats(self):
+        outdir = test_output_get_run_dir()
+        statsfile = "{0}/test_MemPool_stats.txt".format(outdir)
+
+        self.Statistics_test_template("undeleted_items", None, "--output-mempool-stats={0}".format(statsfile),
+                                      "undeleted_items_stats")
+
+        allocs = 0
+        frees = 0
+        live = 0
+        classes = set()
+        with open(statsfile, 'r') as f:
+            for line in f:
+                fields = line.split()
+                if not fields:
+                    continue
+                if fields[0] == "pool":
+                    allocs += int(fields[5])
+                    frees += int(fields[6])
+                elif fields[0] == "live":
+                    live += int(fields[3])
+                    classes.add(fields[4])
+        self.assertTrue(allocs > 0, "No allocations found in mempool stats file {0}".format(statsfile))
+        self.assertEqual(allocs - frees, live, "Live entries in {0} don't match allocations - frees".format(statsfile))
+        self.assertTrue("SST::CoreTestMemPoolTest::MemPoolTestEvent1" in classes,
+                        "Undeleted events not found in mempool stats file {0}".format(statsfile))
+
+        self.Statistics_test_template("undeleted_items", None, "--mempool-profile={0}".format(statsfile),
+                                      "undeleted_items_profile")
+
 #####
 
-    def Statistics_test_template(self, testtype, num_threads = None):
+    def Statistics_test_template(self, testtype, num_threads = None, other_args = "", outstr = None):
+        if outstr is None:
+            outstr = testtype
         testsuitedir = self.get_testsuite_dir()
         outdir = test_output_get_run_dir()
 
         sdlfile = "{0}/test_MemPool_{1}.py".format(testsuitedir, testtype)
         reffile = "{0}/refFiles/test_MemPool_{1}.out".format(testsuitedir, testtype)
-        outfile = "{0}/test_MemPool_{1}.out".format(outdir, testtype)
+        outfile = "{0}/test_MemPool_{1}.out".format(outdir, outstr)
 
-        self.run_sst(sdlfile, outfile, num_threads=num_threads)
+        self.run_sst(sdlfile, outfile, num_threads=num_threads, other_args=other_args)
 
         # Perform the test
         filter1 = StartsWithFilter("WARNING: No components are")
         filter2 = StartsWithFilter("#")
-        cmp_result = testing_compare_filtered_diff(testtype, outfile, reffile, True, [filter1, filter2])
+        cmp_result = testing_compare_filtered_diff(outstr, outfile, reffile, True, [filter1, filter2])
         if not cmp_result:
-            diffdata = testing_get_diff_data(testtype)
+            diffdata = testing_get_diff_data(outstr)
             log_failure(diffdata)
         self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile, reffile))
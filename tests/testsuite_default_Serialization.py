@@ -72,6 +72,12 @@ class testcase_Serialization(SSTTestCase):
     def test_Serialization_variant(self):
         self.serialization_test_template("variant")
 
+    def test_Serialization_stdmem_payload(self):
+        self.serialization_test_template("stdmem_payload")
+
+    def test_Serialization_relocatable_event(self):
+        self.serialization_test_template("relocatable_event")
+
 #####
     def serialization_test_template(self, testtype, default_reffile = True):
 
@@ -0,0 +1,160 @@
+# -*- coding: utf-8 -*-
+#
+# Copyright 2009-2025 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2025, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+from sst_unittest import *
+from sst_unittest_support import *
+
+
+class testcase_TimeVortex(SSTTestCase):
+
+    def setUp(self):
+        super(type(self), self).setUp()
+        # Put test based setup code here. it is called once before every test
+
+    def tearDown(self):
+        # Put test based teardown code here. it is called once after every test
+        super(type(self), self).tearDown()
+
+#####
+    parallelerr = "Test only supports serial execution"
+
+    def test_TimeVortex_priority_queue(self):
+        self.timevortex_test_template("priority_queue")
+
+    def test_TimeVortex_priority_queue_interthread(self):
+        self.timevortex_test_template("priority_queue", interthread = True)
+
+    def test_TimeVortex_priority_queue_ts_interthread(self):
+        self.timevortex_test_template("priority_queue.ts", interthread = True)
+
+    def test_TimeVortex_ladder(self):
+        self.timevortex_test_template("ladder")
+
+    @unittest.skipIf(testing_check_get_num_ranks() > 1, parallelerr)
+    @unittest.skipIf(testing_check_get_num_threads() > 1, parallelerr)
+    def test_TimeVortex_ladder_checkpoint(self):
+        self.timevortex_checkpoint_template("ladder")
+
+    def test_TimeVortex_dheap(self):
+        self.timevortex_test_template("dheap")
+
+    @unittest.skipIf(testing_check_get_num_ranks() > 1, parallelerr)
+    @unittest.skipIf(testing_check_get_num_threads() > 1, parallelerr)
+    def test_TimeVortex_dheap_checkpoint(self):
+        self.timevortex_checkpoint_template("dheap")
+
+    def test_TimeVortex_map_radix(self):
+        self.timevortex_test_template("map.radix")
+
+    @unittest.skipIf(testing_check_get_num_ranks() > 1, parallelerr)
+    @unittest.skipIf(testing_check_get_num_threads() > 1, parallelerr)
+    def test_TimeVortex_map_radix_checkpoint(self):
+        self.timevortex_checkpoint_template("map.radix")
+
+    def test_TimeVortex_mpsc(self):
+        self.timevortex_test_template("mpsc")
+
+    def test_TimeVortex_mpsc_interthread(self):
+        self.timevortex_test_template("mpsc", interthread = True)
+
+    @unittest.skipIf(testing_check_get_num_ranks() > 1, parallelerr)
+    @unittest.skipIf(testing_check_get_num_threads() > 1, parallelerr)
+    def test_TimeVortex_mpsc_checkpoint(self):
+        self.timevortex_checkpoint_template("mpsc")
+
+    def test_TimeVortex_priority_queue_batch_dispatch(self):
+        self.timevortex_test_template("priority_queue", "time")
+
+    def test_TimeVortex_priority_queue_batch_dispatch_handler(self):
+        self.timevortex_test_template("priority_queue", "handler")
+
+    def test_TimeVortex_ladder_batch_dispatch(self):
+        self.timevortex_test_template("ladder", "time")
+
+    def test_TimeVortex_dheap_batch_dispatch(self):
+        self.timevortex_test_template("dheap", "time")
+
+#####
+
+    # Runs test_Component.py using the specified TimeVortex and
+    # optional batch-dispatch mode.  If interthread is set, runs with
+    # two threads and direct interthread links so that events between
+    # threads go through the interthread channels, or are inserted into
+    # the other thread's TimeVortex for mpsc and the thread-safe (.ts)
+    # versions.  Output must match the reference file generated with
+    # the default TimeVortex.
+    def timevortex_test_template(self, tv, batch = None, interthread = False):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        name = "TimeVortex_{0}".format(tv)
+        options = "--timeVortex=sst.timevortex.{0}".format(tv)
+        if batch:
+            name += "_batch_{0}".format(batch)
+            options += " --batch-dispatch={0}".format(batch)
+        num_threads = None
+        if interthread:
+            name += "_interthread"
+            options += " --interthread-links"
+            num_threads = 2
+
+        sdlfile = "{0}/test_Component.py".format(testsuitedir)
+        reffile = "{0}/refFiles/test_Component.out".format(testsuitedir)
+        outfile = "{0}/test_{1}.out".format(outdir, name)
+
+        self.run_sst(sdlfile, outfile, other_args=options, num_threads=num_threads)
+
+        cmp_result = testing_compare_sorted_diff(name, outfile, reffile)
+        if not cmp_result:
+            diffdata = testing_get_diff_data(name)
+            log_failure(diffdata)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile, reffile))
+
+        # Grouping by handler changes the order events are delivered
+        # in, so make sure the order is the same from run to run.
+        # The order of output from multiple threads or ranks can vary,
+        # so only check serial runs.
+        if batch == "handler" and testing_check_get_num_ranks() == 1 and testing_check_get_num_threads() == 1:
+            outfile_rerun = "{0}/test_{1}_rerun.out".format(outdir, name)
+            self.run_sst(sdlfile, outfile_rerun, other_args=options)
+            cmp_result = testing_compare_diff(name + "_rerun", outfile_rerun, outfile)
+            self.assertTrue(cmp_result, "Output order from {0} does not match {1}".format(outfile_rerun, outfile))
+
+    # Checkpoints test_Checkpoint.py using the specified TimeVortex,
+    # then restarts from the first checkpoint.  This verifies that
+    # getContents() returns the full state of the TimeVortex.
+    def timevortex_checkpoint_template(self, tv):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_Checkpoint.py".format(testsuitedir)
+        reffile = "{0}/refFiles/test_Checkpoint.out".format(testsuitedir)
+        outfile_cpt = "{0}/test_TimeVortex_{1}_cpt.out".format(outdir, tv)
+        outfile_rst = "{0}/test_TimeVortex_{1}_rst.out".format(outdir, tv)
+        prefix = "TimeVortex_{0}_cpt".format(tv)
+
+        options_cpt = (
+            "--timeVortex=sst.timevortex.{0} --checkpoint-sim-period=250us --checkpoint-prefix={1} "
+            "--checkpoint-name-format='%p_%n' --output-directory=testsuite_timevortex".format(tv, prefix))
+        self.run_sst(sdlfile, outfile_cpt, other_args=options_cpt)
+
+        filters_cpt = [ CheckpointInfoFilter() ]
+        cmp_result = testing_compare_filtered_diff("TimeVortex_{0}_cpt".format(tv), outfile_cpt, reffile, True, filters_cpt)
+        self.assertTrue(cmp_result, "Output from checkpoint run {0} did not match reference file {1}".format(outfile_cpt, reffile))
+
+        sdlfile_rst = "{0}/testsuite_timevortex/{1}/{1}_1/{1}_1.sstcpt".format(outdir, prefix)
+        self.run_sst(sdlfile_rst, outfile_rst, other_args="--load-checkpoint")
+
+        filters_rst = [ CheckpointRefFileFilter(1), CheckpointInfoFilter() ]
+        cmp_result = testing_compare_filtered_diff("TimeVortex_{0}_rst".format(tv), outfile_rst, reffile, True, filters_rst)
+        self.assertTrue(cmp_result, "Output from restart run {0} did not match reference file {1}".format(outfile_rst, reffile))
@@ -70,6 +70,9 @@ class testcase_TimingInfo(SSTTestCase):
             "global_sync_data_size",
             "max_mempool_size",
             "global_mempool_size",
+            "max_link_storage_size",
+            "global_link_storage_size",
+            "global_links",
             "global_active_activities",
             "global_current_tv_depth",
             "global_max_tv_depth",